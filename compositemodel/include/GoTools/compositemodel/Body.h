@@ -162,6 +162,24 @@ namespace Go
 	    /// difference vector and surface normal
 	    bool isInside(const Point& pnt, double& dist, double& ang) const;
 
+	    /// Classify a set of points with respect to this body. The
+	    /// points are given as consecutive (x,y,z) triples. Points sharing
+	    /// y and z coordinates, as in a voxel grid, are classified from the
+	    /// same line intersection. Rows where the intersection count is
+	    /// not consistent are classified one point at a time using isInside.
+	    /// Points closer to the boundary than the gap tolerance are on
+	    /// the boundary, whether or not the distances are requested.
+	    /// The rows are processed in parallel if OpenMP is enabled.
+	    /// \param pts Points, size 3*nmb_pts.
+	    /// \param nmb_pts Number of points.
+	    /// \retval classification 1 = inside, 0 = on the boundary,
+	    ///                        -1 = outside.
+	    /// \retval dist If given, the signed distance to the boundary,
+	    ///              negative inside the body.
+	    void classifyPoints(const double* pts, int nmb_pts,
+				std::vector<int>& classification,
+				std::vector<double>* dist = 0) const;
+
 	    /// Find the shell containing a given face (if any)
 	    shared_ptr<SurfaceModel> getShell(ftSurface* face) const;
 
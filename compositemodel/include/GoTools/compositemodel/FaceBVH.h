@@ -0,0 +1,103 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _FACEBVH_H
+#define _FACEBVH_H
+
+#include "GoTools/utils/Point.h"
+#include <vector>
+#include <utility>
+
+namespace Go
+{
+
+class ftSurface;
+
+/// Used internally in SurfaceModel. FaceBVH is a bounding volume hierarchy
+/// over the faces of a surface model, used to find the faces that may be
+/// intersected by a line or a ray. The hierarchy is not changed after
+/// construction and the queries keep all state locally, so queries may be
+/// performed concurrently.
+class FaceBVH
+{
+ public:
+    /// Build the hierarchy. The face boxes are enlarged by tol.
+    FaceBVH(const std::vector<ftSurface*>& faces, double tol);
+    ~FaceBVH();
+
+    int numFaces() const
+        {
+            return (int)faces_.size();
+        }
+
+    ftSurface* face(int idx) const
+        {
+            return faces_[idx];
+        }
+
+    /// The faces whose boxes are intersected by pnt + t*dir, tmin <= t <= tmax.
+    /// Each face index is returned with the parameter t where the line enters
+    /// the face box, sorted on this parameter. The direction must be
+    /// normalized for t to be the distance from pnt.
+    void lineCandidates(const Point& pnt, const Point& dir,
+			double tmin, double tmax,
+			std::vector<std::pair<double, int> >& candidates) const;
+
+ private:
+    struct Node
+    {
+	double low[3];
+	double high[3];
+	int first;   // Leaf: first entry in face_idx_. Inner: right child
+	int count;   // Leaf: number of faces. Inner: 0, left child is next
+    };
+
+    std::vector<ftSurface*> faces_;
+    std::vector<double> box_low_;   // 3 entries per face
+    std::vector<double> box_high_;
+    std::vector<int> face_idx_;
+    std::vector<Node> nodes_;
+
+    int buildNode(std::vector<double>& centre, int first, int count);
+};
+
+} // namespace Go
+
+#endif // _FACEBVH_H
+
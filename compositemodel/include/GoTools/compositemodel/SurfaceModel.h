@@ -44,6 +44,7 @@
 #include "GoTools/compositemodel/ftSurface.h"
 #include "GoTools/compositemodel/ftFaceBase.h"
 #include "GoTools/compositemodel/CellDivision.h"
+#include "GoTools/compositemodel/FaceBVH.h"
 //#include "GoTools/topology/tpTopologyTable.h"
 #include "GoTools/compositemodel/ftCurve.h"
 #include "GoTools/compositemodel/ftPoint.h"
@@ -67,6 +68,7 @@ namespace Go
   class BoundedSurface;
  class ftPointSet;
  class IntResultsSfModel;
+ class GenericTriMesh;
  class Loop;
  class Body;
  struct SamplePointData;
@@ -242,6 +244,15 @@ class GO_API SurfaceModel : public CompositeModel
   /// Creates the CellDivision object
   void initializeCelldiv();
 
+  /// Creates the bounding volume hierarchy used in line and ray queries
+  void initializeFaceBVH();
+
+  /// Prepare for queries from several threads. The face hierarchy is
+  /// created, and so are the data that the faces compute at first use:
+  /// the bounding boxes and the parameter domains of trimmed surfaces.
+  /// Called by the batch queries before they enter a parallel region.
+  void prepareConcurrentQueries();
+
   /// Return a cell in the cell division
   /// \param i Index of cell
   /// \return The cell
@@ -397,6 +408,20 @@ class GO_API SurfaceModel : public CompositeModel
   /// \return Whether the line hits or not.
   bool hit(const Point& point, const Point& dir, ftPoint& result);
 
+  /// Test a number of rays for hits with this surface model. Ray ki starts
+  /// in points[ki] and has direction dirs[ki]. The faces are accessed through a
+  /// bounding volume hierarchy and the rays are processed in parallel if
+  /// OpenMP is enabled.
+  /// \param points Start points of the rays.
+  /// \param dirs Ray directions.
+  /// \retval result Closest intersection point in front of the start point,
+  ///                one entry for each ray.
+  /// \retval dist Distance from the start point to the hit, -1 if the
+  ///              ray does not hit the model.
+  /// \return The number of rays that hit the model.
+  int hit(const std::vector<Point>& points, const std::vector<Point>& dirs,
+	  std::vector<ftPoint>& result, std::vector<double>& dist);
+
 /*   /// The two surface models are intersected and this model is trimmed with respect to the  */
 /*   /// intersection result.  */
 /*   void booleanIntersect(shared_ptr<SurfaceModel>, // The other model */
@@ -428,6 +453,15 @@ class GO_API SurfaceModel : public CompositeModel
   std::vector<ftPoint> intersect(const ftLine& line, 
 				 std::vector<bool>& represent_segment);
 
+   /** Intersect the model with a number of lines. The lines are processed
+       in parallel if OpenMP is enabled.
+       \param lines The intersecting lines
+       \retval int_points For each line, the intersection points sorted
+                along the line. Coincidence segments are represented by their
+                midpoint. */
+  void intersect(const std::vector<ftLine>& lines,
+		 std::vector<std::vector<ftPoint> >& int_points);
+
    /** Intersect the model with a SplineCurve.
        \param crv The intersecting SplineCurve.
        \retval represent_segment ???
@@ -634,6 +668,33 @@ class GO_API SurfaceModel : public CompositeModel
 		 double density,
 		 std::vector<shared_ptr<GeneralMesh> >& meshes) const;
 
+  /// Tesselate all faces into one triangle mesh with shared vertices.
+  /// The edges are sampled once with respect to the given tolerances and
+  /// the samples are used by all adjacent faces, thus the mesh has no
+  /// cracks along edges between connected faces. The faces are
+  /// triangulated adaptively and in parallel, see AdaptiveSurfaceTesselator.
+  /// The boundary loops of the faces are checked and fixed first.
+  /// Throws if a face cannot be triangulated.
+  /// \param chord_tol Maximum distance between the mesh and the model
+  /// \param ang_tol Maximum angle between surface normals (or curve
+  /// tangents) within a triangle (or edge segment)
+  /// \retval mesh Tesselated model
+  /// \return false if the maximum number of vertices in a face was
+  /// reached before the tolerances were met
+  bool tesselateAdaptive(double chord_tol, double ang_tol,
+			 shared_ptr<GenericTriMesh>& mesh);
+
+  /// Tesselate specified faces into one triangle mesh with shared vertices
+  /// \param faces Specified surfaces
+  /// \param chord_tol Maximum distance between the mesh and the model
+  /// \param ang_tol Maximum angle between surface normals (or curve
+  /// tangents) within a triangle (or edge segment)
+  /// \retval mesh Tesselated surfaces
+  /// \return false if the tolerances were not met in all faces
+  bool tesselateAdaptive(const std::vector<shared_ptr<ftFaceBase> >& faces,
+			 double chord_tol, double ang_tol,
+			 shared_ptr<GenericTriMesh>& mesh);
+
   /// Return a tesselation of the control polygon of all surfaces
   /// \retval ctr_pol Tesselation of the control polygon of all surfaces.
   virtual 
@@ -887,6 +948,7 @@ class GO_API SurfaceModel : public CompositeModel
 
   shared_ptr<CellDivision> celldiv_ ;   // To gain speedup in closest point and intersections
   mutable std::vector<bool> face_checked_;
+  shared_ptr<FaceBVH> face_bvh_;  // Line and ray queries, see prepareConcurrentQueries
   //  mutable BoundingBox big_box_;
   BoundingBox limit_box_;
 
@@ -905,6 +967,32 @@ class GO_API SurfaceModel : public CompositeModel
 		      std::vector<ftPoint>& result,
 		      std::vector<ftCurveSegment>& line_segments) const;
 
+  // As above, evaluating surf, which is the surface of sf or a copy of it
+  void localIntersect(const ftLine& line, ftSurface* sf, 
+		      shared_ptr<ParamSurface> surf,
+		      std::vector<ftPoint>& result,
+		      std::vector<ftCurveSegment>& line_segments) const;
+
+  // Closest forward hit using the face hierarchy. If local_sfs is given,
+  // it holds one copy per hierarchy face of the face surfaces, made at
+  // first use, and the copies are evaluated. With a copy per thread the
+  // function may be called concurrently after prepareConcurrentQueries
+  bool hitBVH(const Point& point, const Point& dir, ftPoint& result,
+	      double& dist,
+	      std::vector<shared_ptr<ParamSurface> >* local_sfs) const;
+
+  // All intersections with a line using the face hierarchy, sorted along
+  // the line. Segments are represented by their midpoint. See hitBVH
+  // for local_sfs
+  void intersectBVH(const ftLine& line, std::vector<ftPoint>& result,
+		    std::vector<shared_ptr<ParamSurface> >* local_sfs) const;
+
+  // The surface of face idx in the hierarchy, or the copy of it in
+  // local_sfs if given
+  shared_ptr<ParamSurface> 
+    bvhFaceSurface(int idx,
+		   std::vector<shared_ptr<ParamSurface> >* local_sfs) const;
+
   void localIntersect(shared_ptr<SplineCurve> crv,
 		      ftSurface* sf,
 		      std::vector<std::pair<ftPoint, double> >& result,
@@ -123,7 +123,9 @@ namespace Go
 			     std::vector<std::vector<std::pair<shared_ptr<ParamSurface>, int> > >& groups,
 			     SurfaceModel *shell1=NULL, SurfaceModel *shell2=0);
 
-    /// Intersect surface with a line
+    /// Intersect surface with a line. The surface is evaluated, several
+    /// threads may call the function at the same time on distinct
+    /// surfaces
     void
       intersectLine(shared_ptr<ParamSurface>& surface,
 		    Point pnt, Point dir, double tol,
@@ -62,6 +62,7 @@
 
 #include "GoTools/geometry/SplineSurface.h"
 #include "GoTools/creators/ConstraintDefinitions.h"
+#include "GoTools/creators/SparseMatrix.h"
 
 #include <vector>
 
@@ -214,13 +215,33 @@ protected:
     std::vector<double>::iterator scoef_;   // Pointer to surface coefficients.      
 
     /// Storage of the equation system.
-    std::vector<double> gmat_;         // Matrix at left side of equation system.  
+    SparseMatrix gmat_;                // Matrix at left side of equation system.  
     std::vector<double> gright_;       // Right side of equation system.      
 
     ///   Free all memory allocated for class members.
     virtual
     void releaseScratch(); 
 
+    /// Position of a coefficient in the equation system, -1 if the
+    /// coefficient is not free.
+    int coefPivot(int idx) const
+    {
+      if (coefknown_[idx] == 0)
+	return pivot_[idx];
+      else if (coefknown_[idx] >= kpointer_)
+	return pivot_[coefknown_[idx]-kpointer_];
+      return -1;
+    }
+
+    /// Set the sparsity pattern of gmat_ from the overlap of the
+    /// B-spline supports.
+    void setMatrixPattern();
+
+    /// Extend the sparsity pattern of gmat_ with the coupling between
+    /// coefficients at opposite sides of a seem.
+    /// \param pardir the parameter direction across the seem, 1 or 2.
+    void addSeemPattern(int pardir);
+
     /// Prepare storage for integrals of inner products of basis functions.
     virtual
     void prepareIntegral();
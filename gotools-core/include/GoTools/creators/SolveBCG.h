@@ -68,6 +68,9 @@ public:
   /// Solve the equation system.
   virtual int solve(double *ex, double *eb, int nn);
 
+  /// Solve the equation system for several right sides, see SolveCG.
+  using SolveCG::solve;
+
 
 private:
 
@@ -53,6 +53,7 @@
 //    Based on  : PrCG.h written by Mike Floater
 //   -----------------------------------------------------------------------
 
+#include "GoTools/creators/SparseMatrix.h"
 #include <vector>
 
 namespace Go
@@ -79,10 +80,29 @@ public:
     /// \param nn the number of unknowns in the system.
     void attachMatrix(double *gmat, int nn);
 
-    /// Prepare for preconditioning.
+    /// Attach the left side of the equation system given as a sparse
+    /// matrix. Entries with value zero are not stored. No test is applied
+    /// on whether the matrix really is symmetric and positive definite.
+    /// \param mat the system matrix for the linear equations.
+    void attachMatrix(const SparseMatrix& mat);
+
+    /// Prepare for preconditioning. The rows are split in blocks
+    /// (see setPrecondBlocks()) which are factorized independently,
+    /// couplings between blocks are not part of the preconditioner.
     /// \param relaxfac relaxation parameter. Range: [0,0, 1.0].
     virtual void precondRILU(double relaxfac);
 
+    /// Set the number of diagonal blocks in the RILU preconditioner.
+    /// Blocks are factorized and applied in parallel. With one block
+    /// the preconditioner is the RILU factorization of the whole matrix.
+    /// More than one block changes the preconditioner, and hence the
+    /// iterations, compared to the default of one block.
+    /// \param nmb_blocks number of blocks. If 0, one block is used for
+    ///                   each OpenMP thread when the system is large,
+    ///                   otherwise one block. Default is 1.
+    void setPrecondBlocks(int nmb_blocks)
+    {nmb_blocks_ = nmb_blocks;}
+
     /// Solve the equation system by conjugate gradient method.
     /// \param ex the solution vector.  The input should be the initial
     ///           guess.  Size is equal to nn.
@@ -91,6 +111,20 @@ public:
     /// \return 0: success, 1: iterationcount exceeded, < 0: error.
     int solve(double *ex, double *eb, int nn);
 
+    /// Solve the equation system for several right sides at the same
+    /// time. The matrix is traversed once for all right sides in each
+    /// iteration, the iterations of each right side are the same as
+    /// when solving for it alone.
+    /// \param ex the solution vectors, stored one after the other.  The
+    ///           input should be the initial guess.  Size is nn*nmb_rhs.
+    /// \param eb the right sides of the equation, stored one after the
+    ///           other. Size is nn*nmb_rhs.
+    /// \param nn the number of unknowns int the system.
+    /// \param nmb_rhs the number of right sides.
+    /// \return 0: success, 1: iterationcount exceeded for at least one
+    ///         right side, < 0: error.
+    int solve(double *ex, double *eb, int nn, int nmb_rhs);
+
     /// Set numerical tolerance used by the solver.
     /// \param tolerance numerical tolerance.
     void setTolerance(double tolerance = 1.0e-6)
@@ -123,21 +157,43 @@ protected:
     std::vector<int> diagonal_;  // Index of diagonal elements in the jcol
     int diagset_; // Whether the index of the diagonal elements has been set.
 
+    int nmb_blocks_;  // Requested number of blocks in the preconditioner.
+    std::vector<int> block_start_;  // First row of each preconditioner
+                                    // block, followed by nn_. If empty,
+                                    // the preconditioner is one block.
+
+    // Transpose of A_, used when computing A_^T * sx. Built on demand.
+    std::vector<double> At_;
+    std::vector<int> irow_t_;
+    std::vector<int> jcol_t_;
+
+    // Minimum size of the equation system for running the matrix and
+    // vector operations in parallel.
+    static const int par_limit_ = 1000;
+
     /// Compute the matrix product sy = A_ * sx.
     /// \param sx the vector to be multiplied by the matrix.
     /// \param sy the resulting vector.
     template <typename RandomIterator1, typename RandomIterator2>
     void matrixProduct(RandomIterator1 sx, RandomIterator2 sy)
     {
-	int kj, ki;
-	for(kj=0; kj<nn_; kj++) {
-	    sy[kj] = 0.0;
-	    for(ki=irow_[kj]; ki<irow_[kj+1]; ki++) {
-		sy[kj] += A_[ki] * sx[jcol_[ki]];
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) if (nn_ > par_limit_)
+#endif
+	for(int kj=0; kj<nn_; kj++) {
+	    double sum = 0.0;
+	    for(int ki=irow_[kj]; ki<irow_[kj+1]; ki++) {
+		sum += A_[ki] * sx[jcol_[ki]];
 	    }
+	    sy[kj] = sum;
 	}
     }
 
+    /// Compute the matrix product sy = A_ * sx for nmb_rhs vectors.
+    /// The vectors are interleaved, i.e. entry ki of vector kr is
+    /// stored in position ki*nmb_rhs+kr.
+    void matrixProduct(const double *sx, double *sy, int nmb_rhs);
+
     /// Given an index in the full equation system, get the index in A_.
     int getIndex(int ki, int kj);
 
@@ -147,9 +203,19 @@ protected:
     /// \param s the output (unknown) vector.
     void forwBack(double *r, double *s);
 
+    /// Apply preconditioning matrix to nmb_rhs interleaved vectors
+    /// (see matrixProduct()).
+    void forwBack(const double *r, double *s, int nmb_rhs);
+
     // Compute sy = A_^T * sx.
     void transposedMatrixProduct(double *sx, double *sy);
 
+    // Split the rows into blocks for the preconditioner
+    void setBlocks();
+
+    // RILU factorization of the rows and columns from start to end-1 of M_
+    void factorizeBlock(int start, int end);
+
     /// Solve the equation system by conjugate gradient method
     /// using a given RILU (Relaxed Incomplete LU) preconditioner
     /// \param ex the solution vector.  The input should be the initial
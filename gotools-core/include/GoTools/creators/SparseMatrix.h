@@ -0,0 +1,214 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _SPARSEMATRIX_H_
+#define _SPARSEMATRIX_H_
+
+#include "GoTools/utils/errormacros.h"
+#include <vector>
+#include <utility>
+
+namespace Go
+{
+
+/// Square sparse matrix in compressed row storage with a fixed
+/// sparsity pattern. Used when assembling the equation systems of
+/// least squares and smoothing problems, where the pattern follows
+/// from the overlap of B-spline supports. The matrix is handed to
+/// SolveCG and SolveBCG without being expanded to dense storage.
+/// Entries may be added concurrently from several threads once the
+/// pattern is set. Since an exception cannot leave a parallel region,
+/// add() counts entries outside the pattern instead of throwing. Call
+/// checkPattern() after the assembly.
+class SparseMatrix
+{
+public:
+
+    /// Default constructor. Empty matrix.
+    SparseMatrix();
+
+    /// Destructor.
+    ~SparseMatrix();
+
+    /// Define the sparsity pattern and set all values to zero.
+    /// \param nn the number of rows and columns.
+    /// \param row_cols functor with the signature
+    ///        void (int row, std::vector<int>& cols), adding the
+    ///        column indices of the non-zero entries of a row to cols.
+    ///        The indices need not be sorted or unique.
+    template <class RowCols>
+    void setPattern(int nn, RowCols& row_cols)
+    {
+	nn_ = nn;
+	irow_.assign(1, 0);
+	irow_.reserve(nn+1);
+	jcol_.clear();
+	std::vector<int> cols;
+	for (int ki=0; ki<nn; ++ki)
+	{
+	    cols.clear();
+	    row_cols(ki, cols);
+	    appendRow(cols);
+	}
+	A_.assign(jcol_.size(), 0.0);
+	nmb_rejected_ = 0;
+    }
+
+    /// Add entries to the sparsity pattern, keeping the current values.
+    /// \param entries pairs of (row, column) indices, both less than size().
+    void extendPattern(const std::vector<std::pair<int,int> >& entries);
+
+    /// Keep only the leading nn x nn block of the matrix.
+    void truncate(int nn);
+
+    /// Set all values to zero, keeping the pattern. Resets the count
+    /// of rejected entries.
+    void zero();
+
+    /// Add the values of a matrix with the same pattern, typically a
+    /// copy of this matrix where another thread has accumulated terms.
+    /// The count of rejected entries is added as well.
+    void addValues(const SparseMatrix& other);
+
+    /// Number of non-zero values given to add() outside the pattern
+    /// since the pattern was set or the matrix was zeroed.
+    int numRejected() const
+    { return nmb_rejected_; }
+
+    /// Throws if add() has been called with entries outside the pattern.
+    /// Call outside parallel regions.
+    void checkPattern() const
+    {
+	if (nmb_rejected_ > 0)
+	    THROW("Entry outside the sparsity pattern");
+    }
+
+    /// Number of rows and columns.
+    int size() const
+    { return nn_; }
+
+    /// Number of entries in the sparsity pattern.
+    int numNonZeros() const
+    { return (int)jcol_.size(); }
+
+    /// Position of entry (row, col) in the value array, -1 if the
+    /// entry is not part of the pattern.
+    int index(int row, int col) const
+    {
+	if (row < 0 || row >= nn_)
+	    return -1;
+	int jl = irow_[row];
+	int ju = irow_[row+1];
+	while (ju > jl)
+	{
+	    int jm = (jl + ju) >> 1;
+	    if (jcol_[jm] == col)
+		return jm;
+	    if (jcol_[jm] < col)
+		jl = jm + 1;
+	    else
+		ju = jm;
+	}
+	return -1;
+    }
+
+    /// Add a value to entry (row, col). Zero values are ignored,
+    /// otherwise the entry must be part of the pattern. Entries outside
+    /// the pattern are counted, see checkPattern().
+    void add(int row, int col, double val)
+    {
+	if (val == 0.0)
+	    return;
+	int idx = index(row, col);
+	if (idx < 0)
+	{
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+	    ++nmb_rejected_;
+	    return;
+	}
+#ifdef _OPENMP
+#pragma omp atomic
+#endif
+	A_[idx] += val;
+    }
+
+    /// Set the value of entry (row, col), which must be part of the pattern.
+    void set(int row, int col, double val)
+    {
+	int idx = index(row, col);
+	if (idx < 0)
+	    THROW("Entry outside the sparsity pattern");
+	A_[idx] = val;
+    }
+
+    /// Value of entry (row, col).
+    double value(int row, int col) const
+    {
+	int idx = index(row, col);
+	return (idx < 0) ? 0.0 : A_[idx];
+    }
+
+    /// Values, irow()[i] is the position of the first entry in row i.
+    const std::vector<double>& values() const
+    { return A_; }
+
+    /// Position of the first entry in each row, size is size()+1.
+    const std::vector<int>& irow() const
+    { return irow_; }
+
+    /// Column index of each entry.
+    const std::vector<int>& jcol() const
+    { return jcol_; }
+
+private:
+    int nn_;
+    std::vector<double> A_;
+    std::vector<int> irow_;
+    std::vector<int> jcol_;
+    int nmb_rejected_;
+
+    // Sort the column indices, remove duplicates and append to jcol_
+    void appendRow(std::vector<int>& cols);
+};
+
+} // namespace Go
+
+#endif // _SPARSEMATRIX_H_
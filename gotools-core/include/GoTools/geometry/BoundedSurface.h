@@ -203,9 +203,21 @@ public:
     /// rectangular domain (\ref RectDomain) or any other subclass of
     /// \ref Domain (such as CurveBoundedDomain, found in the
     /// \c sisl_dependent module).
+    /// The domain is created at the first call and kept until the
+    /// boundary loops are changed, so any classifier attached to it
+    /// (see createDomainClassifier()) is reused by later queries.
     /// \return a Domain object describing the parametric domain of the surface
     virtual const CurveBoundedDomain& parameterDomain() const;
 
+    /// Attach a point classifier to the parameter domain, see
+    /// CurveBoundedDomain::createClassifier. The classifier is removed
+    /// when the boundary loops are changed by this surface. Changes made
+    /// to the loops through loop() are not detected.
+    /// \param tolerance the largest query tolerance for which the classifier
+    ///                  should be used
+    /// \param nmb_cells number of grid cells in each parameter direction
+    void createDomainClassifier(double tolerance, int nmb_cells = 64);
+
     /// Get a rectangular parameter domain that is guaranteed to contain the
     /// surface's \ref parameterDomain().  It may be the same.  There is no
     /// guarantee that this is the smallest domain containing the actual domain.
@@ -543,6 +555,10 @@ public:
     shared_ptr<CurveLoop> loop(int idx)
       { return boundary_loops_[idx]; }
 
+    /// Get a shared pointer to a specific boundary loop
+    shared_ptr<const CurveLoop> loop(int idx) const
+      { return boundary_loops_[idx]; }
+
     /// Get the space-curve resulting from fixing one of the surface's
     /// parameters and moving the other along its allowed range
     /// (inside the trimmed domain).  If this results in several
@@ -787,6 +803,7 @@ private:
     /// orientation
     std::vector<int> loop_fixed_;
 
+    /// Cached parameter domain, see parameterDomain()
     mutable CurveBoundedDomain domain_;
 
     mutable int iso_trim_;
@@ -806,6 +823,10 @@ private:
                       // -8 = loops not ordered or direction wrong.
                       // -15 = -1 -2 -4 -8, i.e. all artifacts/features.
 
+    // Discard the cached parameter domain after the boundary loops
+    // have been modified
+    void resetDomain();
+
     /// Helper function. When called with analyze = true no fixing is
     /// performed. Otherwise (i.e. if analyze = false) the routine
     /// tries to fix gap(s). If unsuccessful, nothing is changed.
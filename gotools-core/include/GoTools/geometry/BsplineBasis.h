@@ -146,6 +146,15 @@ public:
     /// \param t the parameter value to test.
     int knotInterval(double t) const;
 
+    /// Reentrant version of knotInterval(double). The search starts from
+    /// 'hint' instead of the last knot interval stored in the basis, and the
+    /// result is written back to 'hint'. The basis is not modified, so
+    /// the function may be called concurrently on a shared basis.
+    /// \param t the parameter value to test.
+    /// \param hint start of search, the knot interval on output. Any value
+    ///             is accepted, -1 may be used if no hint is available.
+    int knotInterval(double t, int& hint) const;
+
     /// Create a vector containing the basis values in a given parameter.
     /// \param t the parameter at which to evaluate the basis functions
     /// \param derivs the number of function derivatives to calculate for each nonzero
@@ -173,6 +182,16 @@ public:
 			    int derivs = 0,
 			    double resolution=1.0e-12) const; 
 
+    /// Reentrant version of computeBasisValues(double, double*, int, double).
+    /// The knot interval is searched for starting from 'knot_interval' and
+    /// returned in the same variable, the last knot interval stored in the
+    /// basis is neither used nor changed.
+    void computeBasisValues(double t,
+			    double* basisvals_start,
+			    int derivs,
+			    double resolution,
+			    int& knot_interval) const; 
+
     /// Compute basis values for many points simultaneously.
     /// \param parvals_start pointer to the start of list of parameters where you 
     ///                      want to evaluate the basis functions
@@ -198,12 +217,37 @@ public:
     /// \param  derivs         number of derivatives that should be evaluated for each nonzero
     ///                        basis function (derivs = 0 => only function values will be 
     ///                        computed).
+    /// The function does not use or change the last knot interval stored in
+    /// the basis, and may be called concurrently on a shared basis.
     void computeBasisValues(const double* parvals_start,
 			    const double* parvals_end,
 			    double* basisvals_start,
 			    int* knotinter_start,
 			    int derivs = 0) const;
 
+    /// Compute basis values for a block of parameter values located in
+    /// the same knot interval.  The knot vector values entering the
+    /// computation are then the same for all parameters, so the work is
+    /// done with the parameter index running fastest.  This vectorizes well
+    /// and is intended for batch evaluation of many points.
+    /// \param parvals_start pointer to the start of the parameter values
+    /// \param nmb number of parameter values
+    /// \param knot_interval the knot interval containing all the parameter
+    ///                      values, as returned from knotIntervalFuzzy()
+    /// \param basisvals_start pointer to the memory where the result will
+    ///                        be written, order()*('derivs'+1)*nmb doubles.
+    ///                        Derivative 'd' of nonzero basis function 'i'
+    ///                        at parameter 'p' is stored in
+    ///                        basisvals_start[(i*('derivs'+1) + d)*nmb + p].
+    /// \param derivs number of derivatives that should be evaluated
+    /// \param work temporary storage, resized when necessary
+    void computeBasisValuesBlock(const double* parvals_start,
+				 int nmb,
+				 int knot_interval,
+				 double* basisvals_start,
+				 int derivs,
+				 std::vector<double>& work) const;
+
     /// This function is similar to computeBasisValues(double, int), except that the 
     /// values are calculated from the left, as opposed to the default right-evaluation.
     /// \see computeBasisValues()
@@ -221,9 +265,17 @@ public:
 				int derivs,
 				double resolution=1.0e-12) const;
 
+    /// Reentrant version of computeBasisValuesLeft(double, double*, int, double).
+    /// \see computeBasisValues(double, double*, int, double, int&)
+    void computeBasisValuesLeft(double tval, 
+				double* basisvals_start,
+				int derivs,
+				double resolution,
+				int& knot_interval) const;
+
     /// This function is similar to computeBasisValues(const double*, const double*, 
     /// double*, int*, int), except that the values are calculated from the left, as opposed
-    /// to the default right-evaluation.
+    /// to the default right-evaluation. Reentrant in the same way.
     void computeBasisValuesLeft(const double* parvals_start,
 				const double* parvals_end,
 				double* basisvals_start,
@@ -254,6 +306,10 @@ public:
     ///            that may be the primary wanted effect of this function.
     int knotIntervalFuzzy(double& t, double tol = DEFAULT_PARAMETER_EPSILON) const;
 
+    /// Reentrant version of knotIntervalFuzzy(double&, double).
+    /// \see knotInterval(double, int&)
+    int knotIntervalFuzzy(double& t, int& hint, double tol) const;
+
     /// Insert several knots into the knotvector
     /// \param new_knots a STL vector containing the new knots to insert into the vector
     void insertKnot(const std::vector<double>& new_knots);
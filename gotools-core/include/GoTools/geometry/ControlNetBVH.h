@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _CONTROLNETBVH_H
+#define _CONTROLNETBVH_H
+
+#include <vector>
+
+namespace Go
+{
+
+class SplineSurface;
+
+/// \brief Bounding volume hierarchy over the quadrangles of a rectangular
+/// grid of 3D points, typically the control polygon of a spline surface.
+///
+/// Finds the closest point on the triangulated grid with the same result
+/// as SplineUtils::closest_on_rectgrid(), but visits only the quadrangles
+/// which may contain a closer point than the best found so far. Used to
+/// find start points for closest point iterations on dense surfaces.
+/// The hierarchy is not changed by queries, so queries may run
+/// concurrently.
+
+class ControlNetBVH
+{
+public:
+    /// Constructor.
+    /// \param pts 3D points, the column index runs fastest
+    /// \param m number of columns (first parameter direction)
+    /// \param n number of rows (second parameter direction)
+    ControlNetBVH(const double* pts, int m, int n);
+
+    /// Constructor. Builds the hierarchy over the control polygon of a
+    /// surface. For rational surfaces the projected coefficients are used.
+    /// The surface must be 3-dimensional.
+    ControlNetBVH(const SplineSurface& surf);
+
+    /// Destructor.
+    ~ControlNetBVH();
+
+    /// Number of columns in the grid.
+    int numCols() const
+    { return m_; }
+
+    /// Number of rows in the grid.
+    int numRows() const
+    { return n_; }
+
+    /// Closest point on the triangulated subgrid with columns u_min to
+    /// u_max and rows v_min to v_max. See
+    /// SplineUtils::closest_on_rectgrid() for the parametrization of
+    /// the result.
+    /// \param pt the point to find the closest point for
+    /// \param u_min lowest column index of the subgrid
+    /// \param u_max highest column index of the subgrid
+    /// \param v_min lowest row index of the subgrid
+    /// \param v_max highest row index of the subgrid
+    /// \param clo_u the u-parameter of the closest point
+    /// \param clo_v the v-parameter of the closest point
+    /// \param hint if given and not negative on input, the quadrangle
+    ///             which is checked first. Upon return the quadrangle
+    ///             containing the closest point. Passing the result for
+    ///             one point as the hint for a nearby point speeds up
+    ///             the search, the result does not depend on the hint.
+    void closestOnGrid(const double* pt, int u_min, int u_max,
+		       int v_min, int v_max,
+		       double& clo_u, double& clo_v, int* hint = 0) const;
+
+private:
+    struct Node
+    {
+	double low_[3];
+	double high_[3];
+	int i0_, i1_, j0_, j1_;  // Quadrangles [i0_, i1_) x [j0_, j1_)
+	int child_;              // First of two children, -1 for leaves
+    };
+
+    int m_, n_;
+    std::vector<double> pts_;
+    std::vector<Node> nodes_;
+
+    // Set up node idx for the quadrangles [i0, i1) x [j0, j1)
+    void build(int idx, int i0, int i1, int j0, int j1);
+
+    // Check the two triangles of quadrangle (i, j), and update the best
+    // result if a closer point is found
+    void checkQuad(const double* pt, int i, int j, double& best_dist2,
+		   int& best_key, double& best_u, double& best_v) const;
+};
+
+} // namespace Go
+
+#endif // _CONTROLNETBVH_H
@@ -89,6 +89,12 @@ public:
       return (int)loops_.size();
     }
 
+    /// Fetch one of the loops defining the domain
+    shared_ptr<CurveLoop> loop(int idx) const
+    {
+      return loops_[idx];
+    }
+
     /// Query whether a given parameter pair is inside the domain or
     /// not.
     /// \param point array containing the parameter pair
@@ -101,6 +107,45 @@ public:
     virtual bool isInDomain(const Array<double, 2>& point, 
 			    double tolerance) const;
 
+    /// Query whether a set of parameter pairs are inside the domain or not.
+    /// If a classifier is created (see createClassifier()), it is used to
+    /// decide all points that are not close to the boundary. The remaining
+    /// points are tested as in the single point version of isInDomain.
+    /// \param uv parameter pairs stored consecutively, (u0, v0, u1, v1, ...)
+    /// \param n number of parameter pairs
+    /// \param tolerance the tolerance to be used, see above
+    /// \retval out for each parameter pair, 'true' if the point is found
+    ///         to be inside the domain. Must have space for n entries.
+    void isInDomain(const double* uv, int n, bool* out,
+		    double tolerance) const;
+
+    /// Query whether a set of parameter pairs are inside the domain or not
+    /// using the tolerance given when the classifier was created. Throws
+    /// if no classifier exists.
+    void isInDomain(const double* uv, int n, bool* out) const;
+
+    /// Precompute a classifier to speed up subsequent calls to isInDomain
+    /// and isInDomain2. The boundary loops are approximated by polygons and
+    /// a uniform grid of nmb_cells x nmb_cells cells is laid over the
+    /// parameter domain. Each cell is tagged as inside, outside or close
+    /// to the boundary. Only points in cells close to the boundary require
+    /// intersections with the trimming curves. The classifier is used in
+    /// queries with a tolerance not larger than the given tolerance.
+    /// The classifier is not updated if the boundary loops are changed.
+    /// \param tolerance the largest query tolerance for which the classifier
+    ///                  should be used
+    /// \param nmb_cells number of grid cells in each parameter direction
+    void createClassifier(double tolerance, int nmb_cells = 64);
+
+    /// Remove a classifier created by createClassifier
+    void removeClassifier();
+
+    /// Check if a classifier is created
+    bool hasClassifier() const
+    {
+      return classifier_.get() != 0;
+    }
+
     /// Query whether a given parameter pair is inside the domain or
     /// not.
     /// \param point array containing the parameter pair
@@ -296,6 +341,14 @@ private:
     // We store a set of curve loops
     std::vector<shared_ptr<CurveLoop> > loops_;
 
+    // Optional cached point classifier, see createClassifier
+    struct DomainClassifier;
+    shared_ptr<DomainClassifier> classifier_;
+
+    // Classify a point using the classifier. Return value: 1 : inside,
+    // 0 : outside, -1 : undecided (no classifier or close to the boundary)
+    int classifyPoint(double upar, double vpar, double tolerance) const;
+
     // We return a pointer to a parameter curve defining boundary. If loops_
     // consists of CoCurveOnSurface's, the parameter domain curve is returned.
     // Otherwise we make sure that dimension really is 2.
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _G2BINARYFILE_H
+#define _G2BINARYFILE_H
+
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "GoTools/geometry/GeomObject.h"
+#include "GoTools/geometry/ObjectHeader.h"
+#include "GoTools/utils/config.h"
+
+namespace Go
+{
+
+    /** Binary container for collections of GeomObjects, the counterpart
+     *  of a concatenated .g2 text file.
+     *
+     *  The file consists of a fixed file header, a sequence of
+     *  length-prefixed object records and a table of contents (TOC) at
+     *  the end of the file.  The TOC stores class type, offset and length
+     *  of every record, so a reader can list the contents of a file and
+     *  fetch a single object without parsing the ones preceding it.
+     *  All numbers are stored little-endian.
+     *
+     *  SplineCurve and SplineSurface are stored natively, with knot
+     *  vectors and coefficients as packed arrays of doubles.  A
+     *  BoundedSurface is stored as its underlying surface followed by
+     *  the trimming loops, with the parameter and space curve of every
+     *  CurveOnSurface, each as a nested record that is packed when it is
+     *  a spline.  Any other class is stored as the text written by its
+     *  write() function and is recreated through the Factory, so every
+     *  class known to GoTools::init() can be put in a binary file.
+     *
+     *  Layout:
+     *  \verbatim
+     *  header : char magic[8], uint32 version, uint32 reserved,
+     *           uint64 toc_offset
+     *  record : uint32 class_type, int32 major, int32 minor,
+     *           uint32 encoding, uint32 naux, int32 aux[naux],
+     *           uint64 payload_size, char payload[payload_size]
+     *  nested : uint32 class_type (0 for none), uint32 encoding, then
+     *           the packed data or uint64 size, char text[size]
+     *  toc    : uint64 nmb_records, then per record
+     *           uint32 class_type, uint32 encoding, uint64 offset,
+     *           uint64 size
+     *  \endverbatim
+     */
+
+    /// Writes GeomObjects to a binary .g2 container.
+    class GO_API G2BinaryWriter
+    {
+    public:
+	/// Open a new file for writing.  Throws if the file cannot be
+	/// created.
+	/// \param filename name of the file
+	explicit G2BinaryWriter(const std::string& filename);
+
+	/// Destructor.  Closes the file if close() has not been called.
+	~G2BinaryWriter();
+
+	/// Append an object, using the standard header for its class type.
+	/// \param obj the object to write
+	void write(const GeomObject& obj);
+
+	/// Append an object with a given header.  The auxiliary data of
+	/// the header (for instance a colour) is kept in the file.
+	/// \param header the header of the object, its class type must
+	///               match the instance type of obj
+	/// \param obj the object to write
+	void write(const ObjectHeader& header, const GeomObject& obj);
+
+	/// Number of objects written so far
+	int numObjects() const
+	{ return (int)toc_.size(); }
+
+	/// Write the table of contents and close the file.  No objects can
+	/// be added afterwards.
+	void close();
+
+	struct TocEntry
+	{
+	    ClassType class_type;
+	    int encoding;
+	    unsigned long long offset;
+	    unsigned long long size;
+	};
+
+    private:
+	std::ofstream os_;
+	std::vector<TocEntry> toc_;
+	bool closed_;
+    };
+
+
+    /// Random access reader for binary .g2 containers.  The file is memory
+    /// mapped when the platform supports it and read into memory otherwise.
+    class GO_API G2BinaryReader
+    {
+    public:
+	/// Open a file for reading.  The file header and the table of
+	/// contents are read, the objects are not.  Throws if the file is
+	/// not a binary .g2 file.
+	/// \param filename name of the file
+	explicit G2BinaryReader(const std::string& filename);
+
+	/// Destructor.  Unmaps the file.
+	~G2BinaryReader();
+
+	/// Check whether a file starts with the binary .g2 magic number.
+	/// \param filename name of the file
+	/// \return true if the file is a binary .g2 file
+	static bool isBinaryFile(const std::string& filename);
+
+	/// Number of objects in the file
+	int numObjects() const
+	{ return (int)toc_.size(); }
+
+	/// Class type of an object, taken from the table of contents
+	/// \param idx index of the object
+	ClassType classType(int idx) const;
+
+	/// Indices of all objects of a given class type, in file order
+	/// \param type the requested class type
+	/// \param indices the indices of the objects of this type
+	void objectIndices(ClassType type, std::vector<int>& indices) const;
+
+	/// The header stored with an object
+	/// \param idx index of the object
+	ObjectHeader header(int idx) const;
+
+	/// Create an object from its record.  Only the record of this
+	/// object is parsed.
+	/// \param idx index of the object
+	/// \return the object. Throws if the class type is not registered
+	/// in the Factory.
+	shared_ptr<GeomObject> createObject(int idx) const;
+
+	/// Create all objects of the file, in file order
+	/// \param objs the objects
+	void createAllObjects(std::vector<shared_ptr<GeomObject> >& objs) const;
+
+    private:
+	struct MappedData;
+	shared_ptr<MappedData> data_;
+	std::vector<G2BinaryWriter::TocEntry> toc_;
+	std::map<ClassType, std::vector<int> > type_index_;
+
+	// Fetch record idx. Returns the start of the payload
+	const char* record(int idx, ObjectHeader& header, int& encoding,
+			   unsigned long long& size) const;
+    };
+
+} // namespace Go
+
+#endif // _G2BINARYFILE_H
@@ -48,6 +48,11 @@
 /// \file SISLconversion.h
 /// Declaration file for a set of free conversion functions
 /// between SISL and Spline curves and surfaces.
+///
+/// SISL is not known to be reentrant.  Code that may call SISL from
+/// several threads serialises all the calls, including the conversions
+/// and the freeing of SISL objects, with the named OpenMP critical
+/// section GoTools_SISL.
 
 struct SISLCurve;
 struct SISLSurf;
@@ -44,6 +44,7 @@
 #include "GoTools/utils/DirectionCone.h"
 #include "GoTools/geometry/ParamCurve.h"
 #include "GoTools/geometry/BsplineBasis.h"
+#include "GoTools/geometry/SplineEvalContext.h"
 #include "GoTools/utils/config.h"
 
 namespace Go
@@ -199,6 +200,22 @@ public:
 		       int derivs,
 		       bool from_right = true) const;
 
+    /// Reentrant version of point(Point&, double). Knot interval hints and
+    /// temporary storage are kept in the evaluation context, the curve
+    /// itself is not modified.
+    /// \param pt the evaluated point
+    /// \param tpar the parameter value
+    /// \param ctx evaluation context, one per thread
+    void point(Point& pt, double tpar, SplineEvalContext& ctx) const;
+
+    /// Reentrant version of point(std::vector<Point>&, double, int, bool).
+    /// \see point(Point&, double, SplineEvalContext&)
+    void point(std::vector<Point>& pts, 
+	       double tpar,
+	       int derivs,
+	       SplineEvalContext& ctx,
+	       bool from_right = true) const;
+
     // Inherited from ParamCurve
     virtual double startparam() const;
 
@@ -319,6 +336,14 @@ public:
 		      std::vector<double>& basisValues,
 		      std::vector<double>& basisDerivs) const;
 
+    /// Reentrant version of computeBasis(double, std::vector<double>&, 
+    /// std::vector<double>&).
+    /// \see point(Point&, double, SplineEvalContext&)
+    void computeBasis(double param, 
+		      std::vector<double>& basisValues,
+		      std::vector<double>& basisDerivs,
+		      SplineEvalContext& ctx) const;
+
     /// Evaluate positions and two derivatives of all basis values in a given parameter
     /// For non-rationals this is an interface to BsplineBasis::computeBasisValues,
     /// for rationals the routine evaluates the rational
@@ -351,7 +376,8 @@ public:
 
     /// Evaluation in a number of points
     /// Does not gain effectivity compared to evaluating the points one at the
-    /// time, but provides a unified interface
+    /// time, but provides a unified interface. The curve is not modified,
+    /// and the function may be called concurrently on a shared curve.
     void gridEvaluator(std::vector<double>& points,
 		       const std::vector<double>& par) const;
 
@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _SPLINEEVALCONTEXT_H
+#define _SPLINEEVALCONTEXT_H
+
+#include <vector>
+#include "GoTools/utils/config.h"
+
+namespace Go
+{
+
+/// Structure for storage of the state needed to evaluate spline curves,
+/// surfaces and volumes, i.e. knot interval hints and temporary storage.
+/// The evaluation functions of SplineCurve, SplineSurface and SplineVolume
+/// taking a SplineEvalContext leave the spline object untouched, so a
+/// shared spline object can be evaluated concurrently from several threads
+/// as long as each thread uses its own context. The context may be reused
+/// for any number of evaluations of any spline object.
+struct GO_API SplineEvalContext
+{
+  /// Knot interval hint for each parameter direction, updated during
+  /// evaluation. A negative value means that no hint is available
+  int knot_interval[3];
+  /// Storage for basis values in each parameter direction
+  std::vector<double> basis_vals[3];
+  /// Storage for intermediate results of the tensor product evaluation
+  std::vector<double> work[4];
+
+  SplineEvalContext()
+  {
+    reset();
+  }
+
+  /// Forget the knot interval hints, for instance when the context is to
+  /// be used with another spline object
+  void reset()
+  {
+    knot_interval[0] = knot_interval[1] = knot_interval[2] = -1;
+  }
+};
+
+} // namespace Go
+
+#endif // _SPLINEEVALCONTEXT_H
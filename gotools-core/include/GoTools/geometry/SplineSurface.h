@@ -43,6 +43,7 @@
 
 #include "GoTools/geometry/ParamSurface.h"
 #include "GoTools/geometry/BsplineBasis.h"
+#include "GoTools/geometry/SplineEvalContext.h"
 #include "GoTools/geometry/RectDomain.h"
 #include "GoTools/utils/ScratchVect.h"
 #include "GoTools/utils/config.h"
@@ -54,6 +55,7 @@ class Interpolator;
 class SplineCurve;
 class DirectionCone;
 class ElementarySurface;
+class ControlNetBVH;
 
 /// Structure for storage of results of grid evaluation of the basis function of a spline surface.
 /// Positional evaluation information in one parameter value
@@ -450,6 +452,28 @@ class GO_API SplineSurface : public ParamSurface
 		       bool v_from_right = true,
 		       double resolution = 1.0e-12) const;
 
+    /// Reentrant version of point(Point&, double, double). Knot interval
+    /// hints and temporary storage are kept in the evaluation context, the
+    /// surface itself is not modified. Thus a shared surface may be
+    /// evaluated from several threads, each with its own context.
+    /// \param pt the evaluated point
+    /// \param upar the first parameter value
+    /// \param vpar the second parameter value
+    /// \param ctx evaluation context, one per thread
+    void point(Point& pt, double upar, double vpar, 
+	       SplineEvalContext& ctx) const;
+
+    /// Reentrant version of point(std::vector<Point>&, double, double, int,
+    /// bool, bool, double).
+    /// \see point(Point&, double, double, SplineEvalContext&)
+    void point(std::vector<Point>& pts, 
+	       double upar, double vpar,
+	       int derivs,
+	       SplineEvalContext& ctx,
+	       bool u_from_right = true,
+	       bool v_from_right = true,
+	       double resolution = 1.0e-12) const;
+
     /// Get the start value for the u-parameter
     /// \return the start value for the u-parameter
     virtual double startparam_u() const;
@@ -572,6 +596,35 @@ class GO_API SplineSurface : public ParamSurface
 			      const RectDomain* domain_of_interest = NULL,
 			      double   *seed = 0) const;
 
+    /// Compute the closest point on the surface for a set of points.
+    /// The result for each point is the same as from closestPoint()
+    /// without a seed. The start points are found in a hierarchy over the
+    /// control polygon (see ControlNetBVH), and for consecutive points
+    /// the search starts where the previous point ended, which is fast
+    /// when the points are ordered coherently. The points are
+    /// distributed over threads when OpenMP is enabled.
+    /// \param pts the points, stored consecutively, size nmb_pts*dimension()
+    /// \param nmb_pts the number of points
+    /// \param epsilon requested accuracy
+    /// \param clo_par upon function return the parameter pairs (u, v) of
+    ///                the closest points, size 2*nmb_pts
+    /// \param clo_pts upon function return the closest points, size
+    ///                nmb_pts*dimension()
+    /// \param clo_dist upon function return the distances to the
+    ///                 closest points
+    /// \param domain_of_interest if given, restrict the search to this
+    ///                           domain
+    /// \param seed_index hierarchy over the control polygon of this
+    ///                   surface. May be given to avoid building it for
+    ///                   each call, it must then be created after the last
+    ///                   change of the coefficients.
+    void closestPoints(const double* pts, int nmb_pts, double epsilon,
+		       std::vector<double>& clo_par,
+		       std::vector<double>& clo_pts,
+		       std::vector<double>& clo_dist,
+		       const RectDomain* domain_of_interest = NULL,
+		       const ControlNetBVH* seed_index = NULL) const;
+
     // inherited from ParamSurface
     virtual void closestBoundaryPoint(const Point& pt,
 				      double&        clo_u,
@@ -1076,6 +1129,8 @@ class GO_API SplineSurface : public ParamSurface
 
     /// Evaluate points and normals on an entire grid, taking computational advantage
     /// over calculating all these values simultaneously rather than one-by-one.
+    /// The grid evaluators do not modify the surface, and may be called
+    /// concurrently on a shared surface.
     /// \param num_u number of values to evaluate along first parameter direction
     /// \param num_v number of values to evaluate along second parameter direction
     /// \param points upon function return, this vector holds all the evaluated points
@@ -1163,6 +1218,26 @@ class GO_API SplineSurface : public ParamSurface
 		       std::vector<double>& derivs_v,
 		       bool evaluate_from_right = true) const;
 
+    /// Evaluate points and derivatives in a batch of scattered parameter
+    /// pairs.  This is much faster than calling point() for each pair.
+    /// The pairs are grouped by knot span internally, so they may be
+    /// given in any order.  Input and output use a structure of arrays
+    /// layout.  The function does not modify the surface, and may be
+    /// called concurrently on a shared surface.
+    /// \param param_u the first parameter of each pair
+    /// \param param_v the second parameter of each pair, same size as param_u
+    /// \param derivs number of derivatives to compute
+    /// \param result upon function return, coordinate 'c' of derivative
+    ///               'd' in point 'i' is stored in
+    ///               result[(d*dimension() + c)*param_u.size() + i].  The
+    ///               derivatives are ordered as in
+    ///               point(std::vector<Point>&, double, double, int, bool, bool, double)
+    ///               and the size is param_u.size()*dimension()*(derivs+1)*(derivs+2)/2.
+    void pointsBatch(const std::vector<double>& param_u,
+		     const std::vector<double>& param_v,
+		     int derivs,
+		     std::vector<double>& result) const;
+
     /// Evaluate positions and first derivatives of all basis values in a given parameter pair
     /// For non-rationals this is an interface to BsplineBasis::computeBasisValues 
     /// where the basis values in each parameter direction are multiplied to 
@@ -1236,6 +1311,21 @@ class GO_API SplineSurface : public ParamSurface
 		      BasisDerivsSf& result,
 		      bool evaluate_from_right = true) const;
 
+    /// Reentrant version of computeBasis(double, double, BasisPtsSf&).
+    /// \see point(Point&, double, double, SplineEvalContext&)
+    void computeBasis(double param_u,
+		      double param_v,
+		      BasisPtsSf& result,
+		      SplineEvalContext& ctx) const;
+
+    /// Reentrant version of computeBasis(double, double, BasisDerivsSf&, bool).
+    /// \see point(Point&, double, double, SplineEvalContext&)
+    void computeBasis(double param_u,
+		      double param_v,
+		      BasisDerivsSf& result,
+		      SplineEvalContext& ctx,
+		      bool evaluate_from_right = true) const;
+
     /// Compute basis values (position and uni-directed derivatives) in the parameter
     /// (param_u,param_v). Store result in a BasisDerivsSfU entity
     void computeBasis(double param_u,
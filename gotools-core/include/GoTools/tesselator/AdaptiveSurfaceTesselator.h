@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef ADAPTIVESURFACETESSELATOR_H
+#define ADAPTIVESURFACETESSELATOR_H
+
+#include "GoTools/tesselator/Tesselator.h"
+#include "GoTools/tesselator/GenericTriMesh.h"
+#include "GoTools/geometry/ParamSurface.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+
+/** AdaptiveSurfaceTesselator: create a curvature adaptive triangulation of
+    a possibly trimmed parametric surface. The boundary of the surface is
+    given as closed polygons in the parameter domain and the polygon points
+    are kept unchanged in the mesh. Thus, meshes of adjacent surfaces
+    sharing boundary samples fit together without cracks.
+    The triangulation is a constrained Delaunay triangulation in a scaled
+    parameter domain. Triangles are refined until the distance between the
+    triangle and the surface is less than the chordal tolerance and the
+    angle between the surface normals in the triangle corners is less than
+    the angular tolerance.
+*/
+
+class GO_API AdaptiveSurfaceTesselator : public Tesselator
+{
+public:
+  /// Constructor. Surface and tolerances are given. A non-positive 
+  /// tolerance is not used as refinement criterion.
+  AdaptiveSurfaceTesselator(const ParamSurface& surf, double chord_tol,
+			    double ang_tol);
+
+  /// Destructor
+  virtual ~AdaptiveSurfaceTesselator();
+
+  /// Add a closed boundary polygon. The parameter values of the polygon
+  /// points are given consecutively in par (u1, v1, u2, v2, ...), the last
+  /// point is connected to the first one. Points inside an even number of
+  /// polygons are outside the domain. Optionally the position of the
+  /// polygon points are given (x1, y1, z1, x2, ...), otherwise the surface
+  /// is evaluated. The polygon points are the first vertices of the mesh,
+  /// in the order they are added.
+  void addBoundaryPolygon(const std::vector<double>& par,
+			  const std::vector<double>& pos = std::vector<double>());
+
+  /// Set the maximum number of vertices in the mesh. Refinement stops
+  /// when this number is reached, see toleranceMet(). Default is 100000.
+  void setMaxVertices(int max_vertices)
+  {
+    max_vertices_ = max_vertices;
+  }
+
+  /// Number of boundary polygon points added
+  int numBoundaryVertices() const
+  {
+    return (int)bd_par_.size()/2;
+  }
+
+  virtual void tesselate();
+
+  /// Fetch the resulting mesh. The boundary array flags polygon points.
+  shared_ptr<GenericTriMesh> getMesh()
+  {
+    return mesh_;
+  }
+
+  /// Whether the last tesselation is within the tolerances. False if
+  /// the refinement was stopped by the maximum number of vertices.
+  bool toleranceMet() const
+  {
+    return tolerance_met_;
+  }
+
+private:
+  /// Triangle with vertices in counter clockwise order. nb_[k] is the
+  /// triangle on the other side of the edge opposite to vertex k and
+  /// cons_[k] tells if this edge is part of the boundary
+  struct Triangle
+  {
+    int v_[3];
+    int nb_[3];
+    bool cons_[3];
+    int inside_;
+  };
+
+  const ParamSurface& surf_;
+  double chord_tol_;
+  double ang_tol_;
+  int max_vertices_;
+  bool tolerance_met_;
+  shared_ptr<GenericTriMesh> mesh_;
+
+  std::vector<double> bd_par_;
+  std::vector<double> bd_pos_;
+  std::vector<int> bd_start_;
+
+  // Work data for the triangulation. Vertices are stored with coordinates
+  // in the scaled parameter domain (xy_), parameter value (par_), position
+  // (pos_) and normal (norm_). vtri_ holds one triangle for each vertex
+  double scale_[2];
+  double eps_area_;
+  double eps_len2_;
+  double min_area_;
+  std::vector<double> xy_;
+  std::vector<double> par_;
+  std::vector<double> pos_;
+  std::vector<double> norm_;
+  std::vector<int> vtri_;
+  std::vector<Triangle> tri_;
+  int last_tri_;
+
+  int addVertex(double u, double v, const double* pos);
+  double orient(int i1, int i2, int i3) const;
+  double orient(int i1, int i2, const double* pt) const;
+  bool inCircle(int t, int ix) const;
+  int locate(const double* pt, int start, bool cross_cons, int& on_edge) const;
+  void setNeighbour(int t, int i1, int i2, int nb);
+  void insertVertex(int ix, int t, int on_edge, std::vector<int>& changed);
+  void flip(int t, int k);
+  void delaunayFlips(std::vector<int>& stack);
+  void vertexFan(int ix, std::vector<int>& fan) const;
+  int findEdge(int i1, int i2, int& k) const;
+  bool markSegment(int i1, int i2);
+  void recoverSegment(int i1, int i2);
+  void classifyTriangles(int first_super);
+  bool needsRefinement(int t) const;
+  void refine();
+};
+
+} // namespace Go
+
+#endif // ADAPTIVESURFACETESSELATOR_H
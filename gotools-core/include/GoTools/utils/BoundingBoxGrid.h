@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _BOUNDINGBOXGRID_H
+#define _BOUNDINGBOXGRID_H
+
+#include "GoTools/utils/BoundingBox.h"
+#include "GoTools/utils/config.h"
+#include <vector>
+#include <utility>
+
+namespace Go
+{
+
+    /** Uniform grid over a set of axis-aligned bounding boxes.
+     *  The grid is used to find overlapping boxes without testing
+     *  all pairs. Each box is registered in the grid cells it covers,
+     *  and only boxes sharing a cell are tested against each other.
+     *  The overlap test is BoundingBox::overlaps, so the results
+     *  are identical to those of an all-pairs test. When the boxes
+     *  are of similar size the work is close to linear in the number
+     *  of boxes. Boxes covering many cells are kept aside and tested
+     *  against all other boxes.
+     */
+
+class GO_API BoundingBoxGrid
+{
+public:
+    /// Make a grid over the given boxes.
+    /// \param boxes the boxes. All boxes must have the same dimension.
+    /// \param tol the overlap tolerance used in all queries.
+    BoundingBoxGrid(const std::vector<BoundingBox>& boxes, double tol);
+
+    /// Destructor
+    ~BoundingBoxGrid();
+
+    /// Number of boxes in the grid.
+    int numBoxes() const
+    { return (int)boxes_.size(); }
+
+    /// Fetch all pairs of boxes that overlap within the tolerance.
+    /// \param pairs upon return, the index pairs (i, j) with i < j,
+    /// sorted in lexicographical order.
+    void overlappingPairs(std::vector<std::pair<int, int> >& pairs) const;
+
+    /// Fetch the boxes overlapping a given box within the tolerance.
+    /// \param box the box to test.
+    /// \param indices upon return, the indices of the overlapping boxes
+    /// in increasing order.
+    void overlappingBoxes(const BoundingBox& box, 
+			  std::vector<int>& indices) const;
+
+private:
+    std::vector<BoundingBox> boxes_;
+    double tol_;
+    int dim_;
+    double cell_size_;
+    std::vector<double> origin_;
+    std::vector<long long> ncells_;  // Number of cells in each direction
+
+    // Range of cells covered by each box, dim_ entries per box
+    std::vector<long long> cell_low_;
+    std::vector<long long> cell_high_;
+
+    // (cell key, box index) for all registered boxes, sorted by key
+    std::vector<std::pair<long long, int> > entries_;
+
+    // Boxes covering too many cells to be registered
+    std::vector<int> large_;
+
+    void cellRange(const BoundingBox& box, long long* low, 
+		   long long* high) const;
+    long long cellKey(const long long* cell) const;
+};
+
+} // namespace Go
+
+#endif // _BOUNDINGBOXGRID_H
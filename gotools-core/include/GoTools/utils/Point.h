@@ -59,13 +59,35 @@ namespace Go {
  *  multiplication by scalars etc, and objects will sometimes be
  *  called 'vectors' in the following. Based on double precision floating
  *  point numbers.
+ *  Points of dimension 4 or less keep their elements inside the object,
+ *  so creating, copying and returning them does not touch the heap.
  */
 class GO_API Point
 {
 private:
+    // Points up to this dimension are stored in local_
+    enum { small_dim = 4 };
+
     double* pstart_;
     int n_;
     bool owns_;
+    double local_[small_dim];
+
+    // Storage for an owning point of dimension dim
+    double* allocate(int dim)
+    {
+	return (dim <= small_dim) ? local_ : new double[dim];
+    }
+
+    void deallocate()
+    {
+	if (owns_ && pstart_ != local_) delete [] pstart_;
+    }
+
+    bool isLocal() const
+    {
+	return pstart_ == local_;
+    }
 
 public:
     /// Default constructor, does not initialize elements.
@@ -73,13 +95,13 @@ public:
     /// default constructed (0-dim) Point are the
     /// assignment operator, resize and setValue(...). This is not enforced.
     Point()
-	: pstart_(0), n_(0), owns_(true)
+	: pstart_(local_), n_(0), owns_(true)
     {}
     /// Constructor taking a dimension argument.
     /// Resulting point is of the specified dimension,
     /// and initialized to zero
     explicit Point(int dim)
-	: pstart_(new double[dim]), n_(dim), owns_(true)
+	: pstart_(allocate(dim)), n_(dim), owns_(true)
     {
       for (int ki=0; ki<dim; ++ki)
 	pstart_[ki] = 0.0;
@@ -87,7 +109,7 @@ public:
     /// Constructor taking 2 arguments, makes the
     /// 2D-point (x,y).
     Point(double x, double y)
-	: pstart_(new double[2]), n_(2), owns_(true)
+	: pstart_(local_), n_(2), owns_(true)
     {
 	pstart_[0] = x;
 	pstart_[1] = y;
@@ -95,7 +117,7 @@ public:
     /// Constructor taking 3 arguments, makes the
     /// 3D-point (x,y,z).
     Point(double x, double y, double z)
-	: pstart_(new double[3]), n_(3), owns_(true)
+	: pstart_(local_), n_(3), owns_(true)
     {
 	pstart_[0] = x;
 	pstart_[1] = y;
@@ -111,7 +133,7 @@ public:
     explicit Point(const Array<T, Dim>& v)
 	: pstart_(0), n_(Dim), owns_(true)
     {
-	pstart_ = new double[n_];
+	pstart_ = allocate(n_);
 #if (!defined (_MSC_VER)  || _MSC_VER > 1599) // Getting rid of warning C4996 on Windows
 	std::copy(v.begin(), v.end(), pstart_);
 #else
@@ -125,7 +147,7 @@ public:
     Point(RandomAccessIterator first, RandomAccessIterator last)
 	: pstart_(0), n_((int)(last - first)), owns_(true)
     {
-	pstart_ = new double[n_];
+	pstart_ = allocate(n_);
 #if (!defined (_MSC_VER)  || _MSC_VER > 1599) // Getting rid of warning C4996 on Windows
 	std::copy(first, last, pstart_);
 #else
@@ -166,7 +188,7 @@ public:
 	: pstart_(0), n_((int)(end-begin)), owns_(own)
     {
 	if (owns_) {
-	    pstart_ = new double[n_];
+	    pstart_ = allocate(n_);
 #if (!defined (_MSC_VER)  || _MSC_VER > 1599) // Getting rid of warning C4996 on Windows
 	    std::copy(begin, end, pstart_);
 #else
@@ -181,7 +203,7 @@ public:
     Point(const Point& v)
 	: pstart_(0), n_(v.n_), owns_(true)
     {
-	pstart_ = new double[n_];
+	pstart_ = allocate(n_);
 #if (!defined (_MSC_VER)  || _MSC_VER > 1599) // Getting rid of warning C4996 on Windows
 	std::copy(v.pstart_, v.pstart_ + n_, pstart_);
 #else
@@ -192,23 +214,46 @@ public:
     /// Assignment operator.
     Point& operator = (const Point &v)
     {
-	Point temp(v);
-	swap(temp);
+	if (this == &v)
+	    return *this;
+	if (owns_ && (n_ == v.n_ || (isLocal() && v.n_ <= small_dim))) {
+	    // Reuse the current storage
+	    n_ = v.n_;
+	    std::copy(v.pstart_, v.pstart_ + n_, pstart_);
+	} else {
+	    Point temp(v);
+	    swap(temp);
+	}
 	return *this;
     }
 
     /// Destructor.
     ~Point()
     {
-	if (owns_) delete [] pstart_;
+	deallocate();
     }
 
     /// Swaps two Point instances. Never throws.
     void swap(Point& other)
     {
+	// Locally stored elements must be moved, heap and non-owned
+	// storage is exchanged by swapping pointers
+	const bool this_local = isLocal();
+	const bool other_local = other.isLocal();
+	double tmp[small_dim];
+	if (this_local)
+	    std::copy(local_, local_ + n_, tmp);
+	if (other_local)
+	    std::copy(other.local_, other.local_ + other.n_, local_);
+	if (this_local)
+	    std::copy(tmp, tmp + n_, other.local_);
 	std::swap(pstart_, other.pstart_);
 	std::swap(n_, other.n_);
 	std::swap(owns_, other.owns_);
+	if (other_local)
+	    pstart_ = local_;
+	if (this_local)
+	    other.pstart_ = other.local_;
     }
 
     /// Reads a Point elementwise from
@@ -244,8 +289,13 @@ public:
     void resize(int d)
     {
 	if (n_ < d) {
-	    Point temp(d);
-	    swap(temp);
+	    if (isLocal() && d <= small_dim) {
+		n_ = d;
+		std::fill(pstart_, pstart_ + n_, 0.0);
+	    } else {
+		Point temp(d);
+		swap(temp);
+	    }
 	} else {
 	    n_ = d;
 	}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _POINTBUCKETING_H
+#define _POINTBUCKETING_H
+
+#include "GoTools/utils/config.h"
+#include <vector>
+
+namespace Go
+{
+
+  /// Distribution of parameterized points into the cells of a rectangular
+  /// grid, typically the elements of a spline surface. The points are
+  /// sorted with respect to cell by a counting sort, which is linear in
+  /// the number of points and runs in parallel when OpenMP is enabled.
+  namespace PointBucketing
+  {
+    /// Find the cell containing a parameter value. Cell i is the interval
+    /// [breaks[i], breaks[i+1]), except for the last cell which also
+    /// contains its right end.
+    /// \param par the parameter value.
+    /// \param breaks the cell boundaries, nmb_cells+1 increasing values.
+    /// \param nmb_cells the number of cells.
+    /// \param clamp if true, values outside the range are assigned to
+    /// the first or last cell.
+    /// \return the cell index, or -1 if the value is outside the range
+    /// and clamp is false.
+    int GO_API cellIndex(double par, const double* breaks, int nmb_cells,
+			 bool clamp);
+
+    /// Reorder points such that the points of each grid cell are stored
+    /// consecutively. The cells are ordered with the first parameter
+    /// direction running fastest, and the points of a cell keep their
+    /// relative order. Temporary storage of the size of the point set is
+    /// used.
+    /// \param points the points, del doubles for each point where the
+    /// first two are the parameter values. Reordered on output.
+    /// \param nmb_pts the number of points.
+    /// \param del the number of doubles for each point.
+    /// \param ubreaks cell boundaries in the first parameter direction,
+    /// nmb_u+1 increasing values.
+    /// \param nmb_u the number of cells in the first parameter direction.
+    /// \param vbreaks cell boundaries in the second parameter direction,
+    /// nmb_v+1 increasing values.
+    /// \param nmb_v the number of cells in the second parameter direction.
+    /// \param clamp if true, points outside the grid are assigned to the
+    /// nearest boundary cell. Otherwise they are placed after the points
+    /// of the last cell.
+    /// \param offsets upon return, nmb_u*nmb_v+2 entries. The points of
+    /// cell (i,j) are the points with index from offsets[j*nmb_u+i] up
+    /// to offsets[j*nmb_u+i+1]. The points outside the grid follow
+    /// up to offsets[nmb_u*nmb_v+1] = nmb_pts.
+    void GO_API bucketPoints(double* points, int nmb_pts, int del,
+			     const double* ubreaks, int nmb_u,
+			     const double* vbreaks, int nmb_v,
+			     bool clamp, std::vector<int>& offsets);
+
+  } // namespace PointBucketing
+
+} // namespace Go
+
+#endif // _POINTBUCKETING_H
@@ -234,6 +234,11 @@ public:
     void readdisp(std::istream& is);
     /// Read an IGES file
     void readIGES(std::istream& is);
+    /// Read an IGES file given by name. The file is memory mapped where
+    /// supported, and independent entities are parsed in parallel when
+    /// compiled with OpenMP. The result is identical to
+    /// readIGES(std::istream&).
+    void readIGES(const std::string& filename);
 
     /// Write the content of this converter to a g2-file
     void writego(std::ostream& os);
@@ -300,6 +305,9 @@ private:
 				 // index referring to colour_id_.
     // ... and transformation matrices.
     std::map< int, Go::CoordinateSystem<3> > coordsystems_;
+    // Directory entry index of each transformation matrix in the file
+    // being read.
+    std::map<int, int> coordsystem_entry_;
 
 #if 0
     // Topological vertices.
@@ -324,6 +332,16 @@ private:
 
     bool readSingleIGESLine(std::istream& is, char line_terminated[81],
 			    int& line_number, IGESSection& sect);
+    /// Split the file content [start, end) into the five section
+    /// strings, in the same way as repeated calls to readSingleIGESLine.
+    void splitIGESSections(const char* start, const char* end,
+			   std::string sbufs[5]);
+    /// Interpret the section strings read from an IGES file
+    void parseIGESSections(std::string sbufs[5]);
+    /// The transformation matrix csentry if it is defined before the
+    /// directory entry direntry_index, otherwise 0.
+    const Go::CoordinateSystem<3>*
+      precedingCoordinateSystem(int csentry, int direntry_index) const;
     void writeSingleIGESLine(std::ostream& os, const char line_terminated[73],
 			     int line_number, IGESSection sect);
     /// If whereami is within the P section, it gives the current line
@@ -376,10 +394,12 @@ private:
                           std::vector<IGESdirentry>& dirent, int& Pcurr,
 			  int dependency = 0);
     shared_ptr<Go::SplineCurve>
-      readIGEScurve(const char* start, int num_lines, int direntry_index);
+      readIGEScurve(const char* start, int num_lines, int direntry_index,
+		    Go::Point& plane_normal);
 //     shared_ptr<Go::SplineCurve>
     shared_ptr<Go::BoundedCurve>
-      readIGESline(const char* start, int num_lines, int direntry_index);
+      readIGESline(const char* start, int num_lines, int direntry_index,
+		   Go::Point& plane_normal);
     shared_ptr<Go::PointCloud3D> readIGESpointCloud(const char* start,
 						int num_lines);
     shared_ptr<Go::PointCloud3D>
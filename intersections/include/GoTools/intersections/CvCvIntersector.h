@@ -115,6 +115,8 @@ protected:
 
     virtual int performRotatedBoxTest(double eps1, double eps2);
 
+    virtual shared_ptr<Intersector> makeDetachedCopy();
+
     virtual bool foundIntersectionNearBoundary();
 
     virtual int simpleCase2(Point& axis1, Point& axis2);
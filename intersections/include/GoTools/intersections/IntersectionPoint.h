@@ -291,6 +291,15 @@ public:
     const ParamObjectInt* getObj2() const
     { return obj2_; }
 
+    /// Let the point refer to other objects with the same geometry,
+    /// typically the originals of the objects in a detached
+    /// sub-intersector.
+    /// \param obj1 the new first object
+    /// \param obj2 the new second object
+    void replaceObjects(const ParamObjectInt* obj1,
+			const ParamObjectInt* obj2)
+    { obj1_ = obj1; obj2_ = obj2; }
+
     /// Get the start value of the parameter interval for the
     /// specified parameter.
     /// \param pardir the parameter for which we seek the start value.
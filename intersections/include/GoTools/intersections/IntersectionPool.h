@@ -239,6 +239,14 @@ public:
     void includeReducedInts(shared_ptr<IntersectionPool>
 			    lower_order_pool);
 
+    /// Include the IntersectionPoints of a pool belonging to a
+    /// detached copy of a sub-intersector into 'this' pool and its
+    /// parents. The points are remapped to the objects of 'this'
+    /// pool, which must have the same geometry as the copies.
+    /// \param detached_pool the pool of the detached sub-intersector
+    void includeDetachedPool(shared_ptr<IntersectionPool>
+			     detached_pool);
+
     /// Reorganize self-intersection parameters.  A 'twin point' is a
     /// concept when working with self-intersection objects.  It
     /// represent an IntersectionPoint that already exist in the
@@ -68,7 +68,7 @@ class Intersector {
 public:
 
     /// Default constructor
-    Intersector() : prev_intersector_(0) {}
+    Intersector() : prev_intersector_(0), nmb_threads_(1) {}
 
     /// Constructor.
     /// \param epsge the geometric tolerance for the intersector.
@@ -202,6 +202,29 @@ public:
     virtual void addComplexDomain(RectDomain dom)
     { ; }
 
+    /// Set the number of threads that may be used for the sub
+    /// intersectors at each recursion level. Intersectors created
+    /// at later recursion levels inherit the value. With more than
+    /// one thread, the sub intersectors that share no intersection
+    /// points with their siblings are computed concurrently. Each of
+    /// them works on copies of the intersection objects and on its
+    /// own intersection pool, and the pools are merged into the
+    /// parent pool in sibling order. The result is thus the same for
+    /// any number of threads larger than one. As the cached data of
+    /// the copied objects is created independently, it may differ
+    /// from the serial result within the tolerances. Self
+    /// intersections and objects that are not splines are always
+    /// treated serially.
+    /// \param nmb_threads the number of threads. 1 (default) gives
+    /// serial execution.
+    void setNumThreads(int nmb_threads)
+    { nmb_threads_ = (nmb_threads > 1) ? nmb_threads : 1; }
+
+    /// Get the number of threads that may be used by the intersector.
+    /// \return The number of threads.
+    int numThreads() const
+    { return nmb_threads_; }
+
     /// Write diagnostic information about the intersection points
     void writeIntersectionPoints() const;
 
@@ -220,6 +243,7 @@ protected:
     shared_ptr<GeoTol> epsge_;
     shared_ptr<SingularityInfo> singularity_info_;
     shared_ptr<ComplexityInfo> complexity_info_;
+    int nmb_threads_;
 
     //     virtual shared_ptr<Intersector> 
     //       lowerOrderIntersector(shared_ptr<ParamObjectInt> obj1,
@@ -276,7 +300,20 @@ protected:
 	}
 
     virtual void printDebugInfo() = 0;
+
+    // Make a copy of this intersector which shares no data with its
+    // siblings or with the original intersection objects, and which
+    // has an intersection pool without parent. The copy is computed
+    // in a single thread. Returns an empty pointer if this is not
+    // possible for the current intersector.
+    virtual shared_ptr<Intersector> makeDetachedCopy()
+    { return shared_ptr<Intersector>(); }
+
 private:
+    // Compute the sub intersectors in sibling order. Independent sub
+    // intersectors are computed concurrently if more than one thread
+    // is allowed.
+    void computeSubIntersectors();
 
 };
 
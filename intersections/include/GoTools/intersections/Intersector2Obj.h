@@ -139,6 +139,10 @@ protected:
     shared_ptr<ParamGeomInt> obj_int_[2];
     int selfint_case_;
 
+    // Copies of the ancestors of obj_int_ in a detached copy of an
+    // intersector. The intersection objects refer to them.
+    std::vector<shared_ptr<ParamGeomInt> > ancestor_copies_;
+
     // NB: The order of the objects ot input is not arbitrary!  The
     // knowledge of what is the 'first object' and the 'second object'
     // can be used internally, and must be consistent with the parent
@@ -220,6 +224,20 @@ protected:
 
     virtual void removeDegenerateConnections() { }
 
+    // Make copies of the intersection objects that share no data
+    // with the originals. The ancestors of the same type are copied
+    // as well and returned in ancestors. Returns false if the objects
+    // can not be copied.
+    bool copyObjects(shared_ptr<ParamGeomInt>& obj1,
+		     shared_ptr<ParamGeomInt>& obj2,
+		     std::vector<shared_ptr<ParamGeomInt> >& ancestors) const;
+
+    // Turn a newly created copy of an intersector into a detached
+    // copy, see makeDetachedCopy(). The intersection pool is replaced
+    // by a pool without parent, and the copy takes over the
+    // ancestors of its intersection objects.
+    void detach(std::vector<shared_ptr<ParamGeomInt> >& ancestors);
+
     void getSeedIteration(double seed[]);
 
     bool atSameBoundary(const double *par1, const double *par2);
@@ -181,6 +181,25 @@ public:
     /// parallell in a boundary point.
     virtual double getOptimizedConeAngle(Point& axis1, Point& axis2) = 0;
 
+    /// Make a copy of this object that shares no data with it. The
+    /// parents of the same type are copied as well, since the
+    /// intersection points refer to the topmost of them. A parent of
+    /// another type is kept.
+    /// \param ancestors the copies of the parents. They must be kept
+    /// as long as the copy is in use.
+    /// \return The copy, or an empty pointer if the object or one of
+    /// its parents can not be copied.
+    shared_ptr<ParamGeomInt>
+    copyWithAncestors(std::vector<shared_ptr<ParamGeomInt> >& ancestors) const;
+
+    /// Make a copy of this object with its own copy of the geometry.
+    /// Cached data is kept. Implemented for spline objects.
+    /// \param parent the parent of the copy.
+    /// \return The copy, or an empty pointer if the object can not
+    /// be copied.
+    virtual shared_ptr<ParamGeomInt> copyObject(ParamObjectInt* parent) const
+    { return shared_ptr<ParamGeomInt>(); }
+
 protected:
     std::vector<shared_ptr<BoundaryGeomInt> > boundary_obj_;
 
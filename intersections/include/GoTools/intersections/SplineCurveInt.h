@@ -77,6 +77,12 @@ public:
     virtual shared_ptr<ParamCurveInt> 
     makeIntObject(shared_ptr<ParamCurve> curve);
 
+    /// Make a copy of this object with its own copy of the spline
+    /// curve.
+    /// \param parent the parent of the copy.
+    /// \return The copy.
+    virtual shared_ptr<ParamGeomInt> copyObject(ParamObjectInt* parent) const;
+
     /// Return true if the object has any inner knots in the specified
     /// parameter direction.
     /// \param pardir the parameter direction in question. Indexing
@@ -87,6 +87,12 @@ public:
     virtual shared_ptr<ParamCurveInt> 
     makeIntCurve(shared_ptr<ParamCurve> crv, ParamGeomInt* parent);
 
+    /// Make a copy of this object with its own copy of the spline
+    /// surface and of the normal surface.
+    /// \param parent the parent of the copy.
+    /// \return The copy.
+    virtual shared_ptr<ParamGeomInt> copyObject(ParamObjectInt* parent) const;
+
     /// Return true if the object has any inner knots in the specified
     /// parameter direction.
     /// \param pardir the parameter direction in question. Indexing
@@ -197,6 +197,17 @@ namespace Go
     // Get geometry surface
     shared_ptr<SplineVolume> volume() const;
 
+    // Matrix-free application of the stiffness matrix of the Laplace operator
+    // in a specified solution space to the coefficients x. The result is
+    // returned in y. See VolSolution::applyOperator()
+    void applyLaplace(int solution_index, const std::vector<double>& x,
+		      std::vector<double>& y);
+
+    // Matrix-free application of the mass matrix in a specified solution
+    // space, see VolSolution::applyOperator()
+    void applyMass(int solution_index, const std::vector<double>& x,
+		   std::vector<double>& y);
+
     // Ensure minimum degree of solution space
     // The solution space will always have at least the degree of the
     // corresponding geometry volume
@@ -129,6 +129,22 @@ namespace Go
     // Fetch all the single block defining this multi-block model
     void getIsogeometricBlocks(std::vector<shared_ptr<IsogeometricVolBlock> >& volblock);
 
+    // Matrix-free application of the stiffness matrix of the Laplace
+    // operator in a specified solution space. x[i] holds the solution
+    // coefficients of block number i, and the result for this block is
+    // returned in y[i]. Contributions to coefficients shared between
+    // neighbouring blocks are not added across the block boundaries, see
+    // IsogeometricVolBlock::applyLaplace()
+    void applyLaplace(int solutionspace_idx,
+		      const std::vector<std::vector<double> >& x,
+		      std::vector<std::vector<double> >& y);
+
+    // Matrix-free application of the mass matrix in a specified solution
+    // space. The block wise storage is as in applyLaplace()
+    void applyMass(int solutionspace_idx,
+		   const std::vector<std::vector<double> >& x,
+		   std::vector<std::vector<double> >& y);
+
   private:
     // The blocks which this block structured model consist of
     std::vector<shared_ptr<IsogeometricVolBlock> > vol_blocks_;
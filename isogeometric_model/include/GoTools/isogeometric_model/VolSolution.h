@@ -78,6 +78,26 @@ namespace Go
     std::vector<double> deriv_w_;  // 1. derivative of the surface in 3. par. dir. in the Gauss points
   };
 
+  struct preEvaluationOperatorVol
+  {
+    // Storage for matrix-free application of the Laplace and mass operators.
+    // Gauss quadrature is applied in each element, i.e. non-empty knot interval
+    // of the solution space. The elements are numbered with the 1. par. dir.
+    // running fastest, and the same holds for the Gauss points in an element.
+    int nmb_coefs_[3];                 // Number of coefficients, used to check validity
+    int nmb_elem_[3];                  // Number of elements in each par. dir.
+    int nmb_gauss_[3];                 // Number of Gauss points in an element in each par. dir.
+    std::vector<double> basisvals_[3]; // Non-zero basis functions and derivatives in the Gauss points
+    std::vector<int> left_[3];         // Knot interval of each element in each par. dir.
+    std::vector<double> laplace_;      // Gauss weight times |det J| times J^-1 J^-T, 6 entries pr Gauss point
+    std::vector<double> mass_;         // Gauss weight times |det J|, 1 entry pr Gauss point
+    std::vector<double> weights_;      // Rational solution: coefficient weights
+    std::vector<double> weight_fun_;   // Rational solution: weight function and derivatives, 4 entries
+                                       // pr Gauss point
+    std::vector<std::vector<int> > colour_; // Elements grouped such that no basis function
+                                            // is non-zero in more than one element of a group
+  };
+
   // This class represents one solution in one block in a block-structured
   // isogeometric volume model
 
@@ -193,6 +213,33 @@ namespace Go
     // pre evaluated values are removed, and this function must be called again
     virtual void performPreEvaluation(std::vector<std::vector<double> >& Gauss_par);
 
+    // Prepare matrix-free application of the Laplace and mass operators,
+    // see applyOperator(). The Gauss quadrature of GaussQuadValues() is
+    // applied in each knot interval of the solution space, and the Jacobian
+    // of the geometry volume is evaluated in all Gauss points.
+    // The function is called by applyOperator() when necessary, but must be
+    // called explicitly if the geometry volume is changed.
+    void performOperatorPreEvaluation();
+
+    // Matrix-free application of the operator
+    // laplace_fac*K + mass_fac*M to the coefficients x, where
+    // K_ij = int grad R_i * grad R_j dV and M_ij = int R_i R_j dV are the
+    // stiffness and mass matrices of the solution space over the geometry
+    // volume. The operator is applied by sum factorization in each element,
+    // and the elements are distributed over threads if OpenMP is enabled.
+    // x and the result y store nmbCoefs()*dimension() values in the same
+    // sequence as the coefficients of the solution volume. Each component
+    // of a vector valued solution is treated separately.
+    void applyOperator(double laplace_fac, double mass_fac,
+		       const std::vector<double>& x, std::vector<double>& y);
+
+    // Matrix-free application of the stiffness matrix of the Laplace
+    // operator, see applyOperator()
+    void applyLaplace(const std::vector<double>& x, std::vector<double>& y);
+
+    // Matrix-free application of the mass matrix, see applyOperator()
+    void applyMass(const std::vector<double>& x, std::vector<double>& y);
+
     // Get value and 1. derivative of all non-zero rational basis funtions
     // in the given Gauss point
     // Requires pre evaluation to be performed.
@@ -340,6 +387,9 @@ namespace Go
     // std::vector<shared_ptr<preEvaluationVol> > evaluated_grid_;
     shared_ptr<preEvaluationVol> evaluated_grid_;
 
+    // Storage for matrix-free application of operators
+    shared_ptr<preEvaluationOperatorVol> evaluated_operator_;
+
     // Pointer to the block to which this boundary condition belongs
     IsogeometricVolBlock* parent_;
 
@@ -85,6 +85,36 @@ namespace Go
 			   double& avdist_out, int& nmb_out,
 			   int mba=1, int tomba=0);
 
+    /// Approximate a point cloud that is too large to be kept in memory.
+    /// The points (x, y, z) are streamed from a file in g2 point cloud
+    /// format (infile) and bucketed on disk into a regular grid of tiles
+    /// using temporary files with the prefix tmp_prefix. Each tile is
+    /// extended by the fraction overlap of its size and approximated with
+    /// a 1D LR B-spline surface (see pointCloud2Spline), the result is
+    /// restricted to the tile and the tile surfaces are stitched with C0
+    /// (cont = 0) or C1 (cont = 1) continuity using LRSurfStitch.
+    /// The number of tiles (nmb_u x nmb_v) is computed from the memory
+    /// budget mem_budget (in bytes) unless nmb_u and nmb_v are positive on
+    /// input. A computed tile grid is refined until every tile meets the
+    /// budget, within a limited number of passes over the file. Tiles
+    /// where the budget is still exceeded are thinned, and the number of
+    /// points left out is returned in nmb_thinned.
+    /// The tile surfaces are returned in sfs, organized from bottom to top
+    /// and from left to right. Tiles without points give a null pointer.
+    /// Accuracy information is computed for the stitched surfaces in a
+    /// final pass over the file, evaluating each point (thinned points
+    /// included) in the tile containing it (without overlap).
+    void pointCloud2SplineTiled(const std::string& infile,
+				const std::string& tmp_prefix,
+				size_t mem_budget, double overlap,
+				double eps, int max_iter, int cont,
+				int& nmb_u, int& nmb_v,
+				std::vector<shared_ptr<LRSplineSurface> >& sfs,
+				double& maxdist, double& avdist,
+				double& avdist_out, int& nmb_out,
+				int& nmb_thinned,
+				int mba=0, int initmba=1, int tomba=5);
+
     /// Compute point cloud distance with respect to an LR B-spline surface
     void computeDistPointSpline(std::vector<double>& points,
 				shared_ptr<LRSplineSurface>& surf,
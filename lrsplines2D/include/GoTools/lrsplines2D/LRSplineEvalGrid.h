@@ -44,8 +44,10 @@
 #include "GoTools/lrsplines2D/LRSplineSurface.h"
 #include "GoTools/lrsplines2D/Element2D.h"
 #include "GoTools/lrsplines2D/Mesh2D.h"
+#include "GoTools/lrsplines2D/LRSplineEvaluator.h"
 
 #include <vector>
+#include <map>
 
 
 namespace Go
@@ -99,24 +101,16 @@ public:
 
 		assert(dim_ ==1 || dim_ == 3);
 
-      Point result(dim_);
-      result.setValue(0.0);
+      // Index of the element in the evaluator, found from the lower
+      // left corner of the element
+      int elem_ix = -1;
+      std::map<std::pair<double, double>, int>::const_iterator it =
+	elem_index_.find(std::make_pair(elem.umin(), elem.vmin()));
+      if (it != elem_index_.end() && elem.contains(scaledU, scaledV))
+	elem_ix = it->second;
 
-      const std::vector<LRBSpline2D*> covering_B_functions = elem.getSupport();
-
-      for (auto b = covering_B_functions.begin();
-	   b != covering_B_functions.end(); ++b)
-	{
-	  const bool u_on_end = (scaledU == (*b)->umax());
-	  const bool v_on_end = (scaledV == (*b)->vmax());
-
-	  result += (*b)->eval(scaledU, 
-			       scaledV, 
-			       0, // No derivs.
-			       0, // No derivs.
-			       u_on_end, 
-			       v_on_end);
-	}
+      double result[3];
+      evaluator_.point(scaledU, scaledV, 0, result, elem_ix);
 
       if (dim_ == 3)
 	{
@@ -279,10 +273,13 @@ public:
 private:
 	RectDomain orig_dom_;
   std::vector<Element2D> elements_;
+  // Lower left corner of each element -> element index in evaluator_
+  std::map<std::pair<double, double>, int> elem_index_;
   int order_u_;
   int order_v_;
   int dim_;
   Mesh2D mesh_;
+  LRSplineEvaluator evaluator_;
 
 
 };
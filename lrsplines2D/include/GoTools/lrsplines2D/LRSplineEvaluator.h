@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _LRSPLINEEVALUATOR_H
+#define _LRSPLINEEVALUATOR_H
+
+#include "GoTools/lrsplines2D/LRSplineSurface.h"
+
+#include <vector>
+
+namespace Go
+{
+
+/// Compiled evaluation structure for an LRSplineSurface.
+/// The element map, the mesh and the B-spline map of the surface are
+/// flattened into contiguous arrays once, after refinement is finished:
+/// the distinct knot values in each direction, a table mapping every
+/// mesh cell (i,j) to the covering element, a compressed list of the
+/// basis functions with support in each element and, for each basis
+/// function, its local knot values, its coefficient times gamma and its
+/// weight. Evaluation does not touch the map structures of the surface
+/// and does not allocate memory in the non-rational case.
+/// The evaluator is a snapshot. It must be rebuilt if the surface is
+/// refined or its coefficients are changed.
+class LRSplineEvaluator
+{
+public:
+  /// Empty evaluator
+  LRSplineEvaluator();
+
+  /// Compile the evaluation structure of the given surface
+  explicit LRSplineEvaluator(const LRSplineSurface& surf);
+
+  /// Recompile the evaluation structure, e.g. after the surface is refined
+  void build(const LRSplineSurface& surf);
+
+  /// Dimension of the geometry space
+  int dimension() const
+  {
+    return dim_;
+  }
+
+  /// Whether the surface is rational
+  bool rational() const
+  {
+    return rational_;
+  }
+
+  int numElements() const
+  {
+    return (int)elem_supp_start_.size() - 1;
+  }
+
+  int numBasisFunctions() const
+  {
+    return (int)weight_.size();
+  }
+
+  /// Index of the element containing the parameter pair, the element
+  /// numbering follows the element map of the surface. Parameters
+  /// outside the domain are moved to the closest boundary.
+  int elementIndex(double u, double v) const;
+
+  /// Evaluate position and partial derivatives up to the total order
+  /// 'derivs' in the parameter pair (u,v). The result is stored in res
+  /// in the same order as in LRSplineSurface::point(), i.e. position,
+  /// d/du, d/dv, d2/du2, d2/dudv, d2/dv2, ..., each with dimension()
+  /// entries. If 'elem' is a valid element index, the element search
+  /// is skipped, the element must then contain (u,v).
+  void point(double u, double v, int derivs, double* res, 
+	     int elem = -1) const;
+
+  /// Evaluate position and derivatives in a set of parameter pairs.
+  /// The result array is resized to num_pts*(derivs+1)*(derivs+2)/2*dim
+  /// and stored point by point, with the layout of point() for each
+  /// point. Computed in parallel when OpenMP is enabled.
+  void points(const std::vector<double>& param_u,
+	      const std::vector<double>& param_v,
+	      int derivs, std::vector<double>& result) const;
+
+private:
+  // Basis functions with support on an element together with the
+  // index of the local knot interval containing the element
+  struct SupportEntry
+  {
+    int bspline;
+    int interval_u;
+    int interval_v;
+  };
+
+  int dim_;
+  bool rational_;
+  int deg_u_;
+  int deg_v_;
+
+  // Distinct knot values
+  std::vector<double> knots_u_;
+  std::vector<double> knots_v_;
+
+  // Element index for each mesh cell, (i,j) is stored in j*(nu-1)+i
+  std::vector<int> cell_elem_;
+
+  // Compressed support lists. Support of element e is stored in
+  // entries elem_supp_start_[e] to elem_supp_start_[e+1]
+  std::vector<int> elem_supp_start_;
+  std::vector<SupportEntry> elem_supp_;
+
+  // Local knot values of the basis functions, deg+2 per function
+  std::vector<double> kval_u_;
+  std::vector<double> kval_v_;
+
+  // Coefficients times gamma, dim_ per function, and weights
+  std::vector<double> coef_;
+  std::vector<double> weight_;
+
+  // Evaluate in a given element, work is required for rational
+  // surfaces and must have size (derivs+1)*(derivs+2)/2*(dim_+1)
+  void evalInElement(int elem, double u, double v, int derivs,
+		     double* res, double* work) const;
+};
+
+} // end namespace Go
+
+#endif // _LRSPLINEEVALUATOR_H
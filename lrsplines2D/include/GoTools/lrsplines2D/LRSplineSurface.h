@@ -41,6 +41,7 @@
 #define _LRSPLINESURFACE_H
 
 #include <array>
+#include <atomic>
 #include <functional>
 #include <set>
 #include <map>
@@ -186,6 +187,8 @@ namespace Go
   LRSplineSurface() 
     {
       curr_element_ = NULL;
+      indexed_lookup_ = false;
+      index_valid_.store(false, std::memory_order_release);
     } 
 
   // Copy constructor
@@ -533,6 +536,22 @@ namespace Go
 //  const ElementMap::value_type&
   Element2D*  coveringElement(double u, double v) const;
 
+  // Select index based lookup of elements and LR B-splines. The maps are
+  // still the storage, but an array of element pointers, a table from mesh
+  // cells to elements and an open addressing hash table of the LR B-splines
+  // are kept alongside. Element location is then two binary searches in the
+  // distinct knots and one table lookup. The tables are made at first use
+  // and remade after the surface is changed. Not selected by default.
+  void setIndexedLookup(bool indexed);
+  bool indexedLookup() const
+  {
+    return indexed_lookup_;
+  }
+
+  // Element number idx in the sequence given by elementsBegin() and
+  // elementsEnd()
+  Element2D* elementFromIndex(int idx) const;
+
   // Construct a mesh of pointers to elements. The mesh has one entry for
   // each possible knot domain. If a knot has multiplicity zero in an area
   // several entries will point to the same element.
@@ -596,7 +615,9 @@ namespace Go
   void refine(const Refinement2D& ref, bool absolute=false);
 
   // Insert a batch of refinements simultaneously.  The 'absolute' argument works as in the two 
-  // preceding refine() methods.
+  // preceding refine() methods.  New mesh lines are added to the mesh in one pass, then the
+  // LR B-splines and elements are updated locally for each refinement. Information stored in 
+  // the elements (data points, accuracy) is kept.
   void refine(const std::vector<Refinement2D>& refs, bool absolute=false);
 
   // @@@ VSK. Index or iterator? Must define how the elements or bsplines 
@@ -692,6 +713,16 @@ namespace Go
   mutable RectDomain domain_;
   mutable Element2D* curr_element_;
 
+  // Index based lookup, see setIndexedLookup(). The index is built on
+  // demand by makeIndex, possibly from several threads. index_valid_ is
+  // set with release ordering after the index is complete
+  bool indexed_lookup_;
+  mutable std::atomic<bool> index_valid_;
+  mutable std::vector<Element2D*> elem_index_;  // Elements in map order
+  mutable std::vector<int> cell_elem_;  // Element index for each mesh cell
+  mutable std::vector<BSplineMap::iterator> bs_hash_; // Open addressing, 
+                                                      // end() marks empty slot
+
    // Private constructor given mesh and LR B-splines
   LRSplineSurface(double knot_tol, bool rational,
 		  Mesh2D& mesh, std::vector<std::unique_ptr<LRBSpline2D> >& b_splines);
@@ -705,6 +736,18 @@ namespace Go
   // Locate all elements in a mesh
   static ElementMap construct_element_map_(const Mesh2D&, const BSplineMap&);
 
+  // Index based lookup
+  void invalidateIndex()
+  {
+    index_valid_.store(false, std::memory_order_release);
+  }
+  void makeIndex() const;
+  static size_t hash_key_(const BSKey& key);
+  // Index of the element containing (u,v), -1 if outside the domain
+  int indexedElement(double u, double v) const;
+  // Look up LR B-spline, uses the hash table if indexed lookup is selected
+  BSplineMap::iterator findBSpline(const BSKey& key);
+
   // Collect all LR B-splines overlapping a specified area
 //    std::vector<std::unique_ptr<LRBSpline2D> > 
     std::vector<LRBSpline2D*> 
@@ -253,7 +253,8 @@ LRSplineSurface::LRSplineSurface(int deg_u,
 // =============================================================================
   : knot_tol_(knot_tol), rational_(false), curr_element_(NULL),
     mesh_(knotvals_u_start, knotvals_u_start + coefs_u + deg_u + 1,
-	  knotvals_v_start, knotvals_v_start + coefs_v + deg_v + 1)
+	  knotvals_v_start, knotvals_v_start + coefs_v + deg_v + 1),
+    indexed_lookup_(false), index_valid_(false)
 {
   std::vector<int> knot_ixs_u = init_knot_indices(mesh_, XFIXED);
   std::vector<int> knot_ixs_v = init_knot_indices(mesh_, YFIXED);
@@ -294,7 +295,8 @@ LRSplineSurface::LRSplineSurface(int deg_u,
 //==============================================================================
 : knot_tol_(knot_tol), rational_(false), curr_element_(NULL),
     mesh_(knotvals_u_start, knotvals_u_start + coefs_u + deg_u + 1,
-	  knotvals_v_start, knotvals_v_start + coefs_v + deg_v + 1)
+	  knotvals_v_start, knotvals_v_start + coefs_v + deg_v + 1),
+    indexed_lookup_(false), index_valid_(false)
 {
   std::vector<int> knot_ixs_u = init_knot_indices(mesh_, XFIXED);
   std::vector<int> knot_ixs_v = init_knot_indices(mesh_, YFIXED);
@@ -72,6 +72,10 @@ namespace Go
 
     void increment_knotvec_indices(LRSplineSurface::BSplineMap& bmap, 
 				   const Direction2D& d, const int& from_ix);
+
+    void remap_knotvec_indices(LRSplineSurface::BSplineMap& bmap, 
+			       const Direction2D& d, 
+			       const std::vector<int>& old_to_new);
     
    LRBSpline2D* 
     insert_basis_function(std::unique_ptr<LRBSpline2D>& b, 
@@ -483,7 +483,17 @@ class LRSurfApprox
 
     void computeAccuracy(std::vector<Element2D*>& ghost_elems);
     // The same as the above, but with OpenMP support (if flag is turned on).
+    // The elements are grouped in chunks with approximately the same
+    // number of points, which are distributed dynamically on the threads.
+    // If a few elements contain most of the points, computeAccuracy
+    // is used instead.
     void computeAccuracy_omp(std::vector<Element2D*>& ghost_elems);
+    // Group elements in chunks with approximately nmb_pts/nmb_chunks points
+    // each. The elements of chunk ki are chunk_elem[chunk_start[ki]] to
+    // chunk_elem[chunk_start[ki+1]-1]. The chunks with most points come first
+    static void scheduleElements(const std::vector<int>& nmb_pts, int nmb_chunks,
+				 std::vector<int>& chunk_start,
+				 std::vector<int>& chunk_elem);
     void computeAccuracyElement(std::vector<double>& points, int nmb, int del,
 				RectDomain& rd, const Element2D* elem,
 				std::vector<double>& prev_points_dist);
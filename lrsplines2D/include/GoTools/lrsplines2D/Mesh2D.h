@@ -250,6 +250,15 @@ public:
   //        and 'incrementMult()' member functions).
   int insertLine (Direction2D d, double kval, int mult = 0);
 
+  // Insert several lines with X (or Y) fixed at the values in 'kvals'
+  // in one pass over the mesh. The lines get zero multiplicity, which
+  // can be changed with 'setMult()' and 'incrementMult()'.  As for
+  // 'insertLine()', the knot values must be different from the values
+  // already in the mesh in the given direction.
+  // Returns, for each knot index prior to the insertion, the
+  // corresponding knot index after the insertion.
+  std::vector<int> insertLines(Direction2D d, std::vector<double> kvals);
+
   // Change the parameter domain for the mesh.
   void setParameterDomain(double u1, double u2, double v1, double v2);
 
@@ -27,6 +27,35 @@ namespace Go
 					      const double tol = 1e-6,
 					      const bool include_3D_curves = false,
 					      const bool use_sisl_marching = false);
+
+  // Start information for marching out one level-set curve: the first
+  // (u1, v1) and last (u2, v2) guide point in the parameter plane, and
+  // whether the curve is open.
+  struct IsocontourSeed
+  {
+    double u1, v1, u2, v2;
+    bool open;
+  };
+
+  // Compute the topology of the level-sets of 'ss' for the values in
+  // 'isovals', i.e. the first step of SSurfTraceIsocontours.  The output has
+  // one entry per entry in 'isovals', with one seed per level-set curve.
+  // SISL is used, and as SISL is not known to be reentrant the computation is
+  // serialised with the other SISL calls of GoTools when running on several
+  // threads.
+  std::vector<std::vector<IsocontourSeed> >
+  SSurfIsocontourTopology(const SplineSurface& ss,
+			  const std::vector<double>& isovals);
+
+  // March out the level-set curves of 'ss' from the seeds computed by
+  // SSurfIsocontourTopology, with the native marching routine.  The output
+  // is as for SSurfTraceIsocontours.  SISL is not used, so several threads
+  // may march at the same time, each on its own copy of the surface.
+  std::vector<CurveVec>
+  SSurfMarchIsocontours(const SplineSurface& ss,
+			const std::vector<std::vector<IsocontourSeed> >& seeds,
+			const double tol = 1e-6,
+			const bool include_3D_curves = false);
 }; // end namespace Go;
 
 #endif
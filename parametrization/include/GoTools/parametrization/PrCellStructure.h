@@ -135,6 +135,24 @@ public:
     void getKNearest(const Vector3D& p, int k,
 		     vector<int>& neighbours, int notP = 0) const;
 
+    /// Call getBall() for every point in the cell structure.  The queries
+    /// are run in parallel if OpenMP is enabled.
+    /// \param radius the radius of the balls
+    /// \retval neighbours entry i will be filled with the indexes of
+    ///                    the neighbours of point i.
+    /// \param notP if != 0, point i will not be included in its own list.
+    void getAllBalls(double radius, vector<vector<int> >& neighbours,
+		     int notP = 0) const;
+
+    /// Call getKNearest() for every point in the cell structure.  The
+    /// queries are run in parallel if OpenMP is enabled.
+    /// \param k the number of neighbours we seek
+    /// \retval neighbours entry i will be filled with the indexes of
+    ///                    the neighbours of point i.
+    /// \param notP if != 0, point i will not be included in its own list.
+    void getAllKNearest(int k, vector<vector<int> >& neighbours,
+			int notP = 0) const;
+
     /// Get the index of the cell positioned at 'i', 'j', 'k'.
     int getI(int i, int j, int k) const
     {return i + ncells_[0] * (j + ncells_[1] * k); }
@@ -178,7 +196,7 @@ Files:
 Example:
 
 
-See also:
+See also:          PrKdTree
 Developed by:      SINTEF Applied Mathematics, Oslo, Norway
 Author:	           Michael Floater, SINTEF
 Date:              Sep. 99
@@ -41,7 +41,7 @@
 #define PRFASTUNORGANIZED_OP_H
 
 #include "GoTools/parametrization/PrOrganizedPoints.h"
-#include "GoTools/parametrization/PrCellStructure.h"
+#include "GoTools/parametrization/PrKdTree.h"
 #include "GoTools/utils/Array.h"
 #include "GoTools/utils/errormacros.h"
 using Go::Vector2D;
@@ -55,11 +55,13 @@ using Go::Vector2D;
  * The major difference to the class PrUnorganized_OP
  * is that this class stores the neighbours for each vertex.
  * Note that this requires the call of "initNeighbours" first! 
+ * The neighbours are found with a kd-tree, so the cost does not
+ * depend on how uniformly the points are distributed.
  */
 class PrFastUnorganized_OP : public PrOrganizedPoints
 {
 private:
-  PrCellStructure cellstruct_;
+  PrKdTree kdtree_;
   vector<Vector2D> uv_;
   int nInt_; // no of interior points,
              // so xyz_(0),...,xyz_(nInt_-1) are the interior points
@@ -70,13 +72,14 @@ private:
   int use_k_; // = 1 use k nearest, = 0 use fixed radius
 
   // additional function and memory to store neighbours explicitly
-  void findNeighbours(int i, vector<int>& neighbours) const;
+  void orderBoundaryNeighbours(int i, vector<int>& neighbours) const;
   vector< vector<int> > nbrs;
 
 public:
-  /// Constructor
+  /// Constructor.  'num_cells' is kept for compatibility with
+  /// PrUnorganized_OP and is not used, as the kd-tree adapts to the points.
   PrFastUnorganized_OP(int num_cells = 10);
-  /// Constructor
+  /// Constructor.  'num_cells' is not used, see above.
   PrFastUnorganized_OP(int n, int n_int, double* xyz_points, int num_cells = 10);
   /// Destructor
   ~PrFastUnorganized_OP() {};
@@ -84,14 +87,15 @@ public:
   /// Compute (and internally store) information about the neighbours of each 
   /// point.  Neighbours are defined either by the \em k nearest points or by
   /// all points within a specified radius.  Use the member functions useK() and
-  /// useRadius() to specify this.
+  /// useRadius() to specify this.  The neighbourhoods of all points are
+  /// found in parallel if OpenMP is enabled.
   void initNeighbours() ;
 
   //             Derived from base class
   /// Return the number of nodes in the graph.
-  virtual int       getNumNodes() const  {return cellstruct_.getNumNodes(); }
+  virtual int       getNumNodes() const  {return kdtree_.getNumNodes(); }
   /// Return the i-th node in the graph if the nodes are three-dimensional.
-  virtual Vector3D get3dNode(int i) const {return cellstruct_.get3dNode(i); }
+  virtual Vector3D get3dNode(int i) const {return kdtree_.get3dNode(i); }
   /// This inherited member function does not apply to this derived class.
   /// As of now, it will throw if you try to run it.
   virtual void        set3dNode(int i, const Vector3D& p)
@@ -150,8 +154,7 @@ public:
   ///           <li> then: all internal point coordinates listed as xyz xyz, etc. </li>
   ///           <li> finally: the boundary point coordinates </li>
   ///           </ul>
-  /// \param num_cells number of cells in each spatial direction when dividing up
-  ///                  the space containing the points.
+  /// \param num_cells not used, kept for compatibility.
   /// \param noise magnitude of noise added to the internal points.  Zero by default. 
   void scanRawData(istream& is, int num_cells = 10, double noise = 0.0);
 };
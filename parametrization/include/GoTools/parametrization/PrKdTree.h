@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef PRKDTREE_H
+#define PRKDTREE_H
+
+#include "GoTools/utils/Array.h"
+using Go::Vector3D;
+#include <vector>
+using std::vector;
+using std::istream;
+using std::ostream;
+
+/*<PrKdTree-syntax: */
+
+/** PrKdTree - Represents a set of points in three dimensions
+ * and a kd-tree on them: a binary tree of axis aligned boxes, each box
+ * split at the median point along its longest side.
+ * It offers the same queries as PrCellStructure, but as the tree adapts
+ * to the point distribution, query cost does not degrade when the points
+ * are strongly clustered.
+ * Creating the tree requires O(N log N) operations, 
+ * where \a N is the number of points.
+ */
+class PrKdTree
+{
+private:
+    struct Node
+    {
+      double min_[3]; // bounding box of the points in the node
+      double max_[3];
+      int start_;     // points perm_[start_],...,perm_[end_-1]
+      int end_;
+      int left_;      // child nodes, -1 for a leaf
+      int right_;
+      int parent_;    // -1 for the root
+    };
+
+    vector<Vector3D> xyz_;
+    vector<int> perm_; // point indices ordered such that each node is a range
+    vector<Node> nodes_;
+    vector<int> leaf_; // the leaf containing each point
+    int leaf_size_; // maximum number of points in a leaf
+
+    void makeKdTree();
+    int makeNode(int start, int end, int parent);
+    double boxDist2(int node, const Vector3D& p) const;
+
+public:
+    /// Default constructor
+    PrKdTree() : leaf_size_(8) {}
+    /// Constructor
+    /// \param n total number of points
+    /// \param xyz_points pointer to an array of points stored xyz-wise (The 
+    ///                   points will be copied to internal data structure.
+    /// \param leaf_size maximum number of points in a leaf of the tree
+    PrKdTree(int n, double* xyz_points, int leaf_size = 8);
+
+    /// Destructor
+    virtual ~PrKdTree() {};
+
+    /// Reset the PrKdTree to a set of new points, deleting old content.
+    /// \param n number of points
+    /// \param xyz_points pointer to the array of stored points.  (The points
+    ///                   will be copied to internal data structure).
+    void      attach(int n, const double* xyz_points);
+
+    /// Set the maximum number of points in a leaf of the tree.
+    /// This must be set before the tree is generated (ie. before the 
+    /// 'attach()' command.
+    void      setLeafSize(int leaf_size) {leaf_size_ = leaf_size; }
+
+    /// Get the maximum number of points in a leaf of the tree.
+    int       getLeafSize() const {return leaf_size_; }
+
+    /// Get the number of points (nodes) stored in the tree.
+    int       getNumNodes() const {return (int)xyz_.size(); }
+
+    /// Get a specific point (node) in the PrKdTree by its index.
+    Vector3D get3dNode(int i) const {return xyz_[i]; }
+
+    /// Change the coordinates of a specific point in the PrKdTree.
+    /// The bounding boxes of the tree are updated, but the tree is not 
+    /// rebalanced, so queries get slower if many points are moved far.
+    /// \param i index of node to change
+    /// \param p the new coordinates
+    void       set3dNode(int i, const Vector3D& p);
+
+    /// Return all points within the ball of radius radius around
+    /// the point p. Don't include p itself if notP = 1.
+    /// \param p the center of the ball
+    /// \param radius the radius of the ball
+    /// \retval neighbours will be filled with the indexes of the 
+    ///                    neighbour points.
+    /// \param notP if != 0, 'p' itself will not be included in
+    ///             the list of returned points.
+    void getBall(const Vector3D& p, double radius,
+		 vector<int>& neighbours, int notP = 0) const;
+
+    /// Return k nearest points to the point p, sorted by increasing
+    /// distance.  Don't include p itself if notP = 1.
+    /// \param p the point for which we seek the k nearest neighbours
+    /// \param k the number of neighbours we seek
+    /// \retval neighbours will be filled with the indexes of the 
+    ///                    neighbour points.
+    /// \param notP if != 0, 'p' itself will not be included in the 
+    ///             list of returned points.
+    void getKNearest(const Vector3D& p, int k,
+		     vector<int>& neighbours, int notP = 0) const;
+
+    /// Call getBall() for every point in the tree.  The queries are
+    /// run in parallel if OpenMP is enabled.
+    /// \param radius the radius of the balls
+    /// \retval neighbours entry i will be filled with the indexes of
+    ///                    the neighbours of point i.
+    /// \param notP if != 0, point i will not be included in its own list.
+    void getAllBalls(double radius, vector<vector<int> >& neighbours,
+		     int notP = 0) const;
+
+    /// Call getKNearest() for every point in the tree.  The queries are
+    /// run in parallel if OpenMP is enabled.
+    /// \param k the number of neighbours we seek
+    /// \retval neighbours entry i will be filled with the indexes of
+    ///                    the neighbours of point i.
+    /// \param notP if != 0, point i will not be included in its own list.
+    void getAllKNearest(int k, vector<vector<int> >& neighbours,
+			int notP = 0) const;
+
+    //print and scan routines
+    /// write points to stream
+    void print(ostream& os);
+
+    /// read points from stream and regenerate the tree.
+    void scan(istream& is);
+};
+
+/*>PrKdTree-syntax: */
+
+/*Class:PrKdTree
+
+Name:              PrKdTree
+Syntax:	           @PrKdTree-syntax
+Keywords:
+Description:       This class represents a set of points in three dimensions
+                   and a kd-tree on them.  It offers the same queries as
+                   PrCellStructure, finding all points in a ball or the
+                   k nearest points, but adapts to non-uniform point sets.
+                   Creating the tree requires O(N log N) operations,
+                   where $N$ is the number of points.
+Member functions:
+
+Constructors:
+Files:
+Example:
+
+
+See also:          PrCellStructure
+Developed by:      SINTEF Applied Mathematics, Oslo, Norway
+*/
+
+#endif // PRKDTREE_H
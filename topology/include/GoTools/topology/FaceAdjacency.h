@@ -55,6 +55,9 @@
 #include <set>
 #include <memory>
 #include <fstream>
+#include <algorithm>
+#include <limits>
+#include <cmath>
 
 namespace Go
 {
@@ -76,6 +79,160 @@ public:
     bool operator < (const MarchPoint& other) const
     { return par < other.par; }
 };
+
+/// Helper class for the broad phase of the adjacency analysis. The
+/// boxes are sorted on the lower bound in the coordinate direction
+/// where they are most spread (sweep and prune). Boxes that are
+/// further apart than the tolerance in this direction are never
+/// reported, the caller makes the complete overlap test.
+class BoxSweep
+{
+public:
+  /// Sort the given boxes. Boxes added to the vector later are
+  /// reported as candidates for all boxes
+  BoxSweep(const std::vector<Go::BoundingBox>& boxes, double tol)
+    : dir_(0), tol_(tol), max_ext_(0.0), nmb_((int)boxes.size())
+  {
+    int ki, kd;
+    int dim = 0;
+    for (ki=0; ki<nmb_; ++ki)
+      dim = std::max(dim, boxes[ki].dimension());
+
+    // Choose the direction with the largest spread of box centres
+    double max_spread = -1.0;
+    for (kd=0; kd<dim; ++kd)
+      {
+	double cmin = std::numeric_limits<double>::max();
+	double cmax = -std::numeric_limits<double>::max();
+	for (ki=0; ki<nmb_; ++ki)
+	  {
+	    if (boxes[ki].dimension() != dim)
+	      continue;
+	    double mid = 0.5*(boxes[ki].low()[kd] + boxes[ki].high()[kd]);
+	    cmin = std::min(cmin, mid);
+	    cmax = std::max(cmax, mid);
+	  }
+	if (cmax - cmin > max_spread)
+	  {
+	    max_spread = cmax - cmin;
+	    dir_ = kd;
+	  }
+      }
+
+    std::vector<std::pair<double, int> > sorted;
+    sorted.reserve(nmb_);
+    for (ki=0; ki<nmb_; ++ki)
+      {
+	if (boxes[ki].dimension() != dim || dim == 0)
+	  other_.push_back(ki);  // Always a candidate
+	else
+	  sorted.push_back(std::make_pair(boxes[ki].low()[dir_], ki));
+      }
+    std::sort(sorted.begin(), sorted.end());
+    idx_.resize(sorted.size());
+    low_.resize(sorted.size());
+    high_.resize(sorted.size());
+    for (size_t kr=0; kr<sorted.size(); ++kr)
+      {
+	idx_[kr] = sorted[kr].second;
+	low_[kr] = sorted[kr].first;
+	high_[kr] = boxes[idx_[kr]].high()[dir_];
+	max_ext_ = std::max(max_ext_, high_[kr] - low_[kr]);
+      }
+  }
+
+  /// Indices of the boxes that may overlap box number idx, in
+  /// increasing order. The index idx itself is included
+  void candidates(const std::vector<Go::BoundingBox>& boxes, int idx,
+		  std::vector<int>& cand) const
+  {
+    cand.clear();
+    const Go::BoundingBox& box = boxes[idx];
+    if (box.dimension() <= dir_)
+      {
+	for (int ki=0; ki<(int)boxes.size(); ++ki)
+	  cand.push_back(ki);
+	return;
+      }
+
+    // The lower bound of an overlapping box is in [lo - tol - ext, hi + tol]
+    // where ext is the largest box extent. The interval is slightly
+    // enlarged to account for rounding, the upper bound is tested
+    // explicitly in the same way as in BoundingBox::overlaps
+    double lo = box.low()[dir_];
+    double hi = box.high()[dir_];
+    double eps = 4.0*std::numeric_limits<double>::epsilon()*
+      (std::fabs(lo) + tol_ + max_ext_);
+    double start = lo - tol_ - 2.0*max_ext_ - eps;
+    size_t kr = std::lower_bound(low_.begin(), low_.end(), start) - 
+      low_.begin();
+    for (; kr<low_.size(); ++kr)
+      {
+	if (hi < low_[kr] - tol_)
+	  break;
+	if (high_[kr] < lo - tol_)
+	  continue;
+	cand.push_back(idx_[kr]);
+      }
+    cand.insert(cand.end(), other_.begin(), other_.end());
+    for (int ki=nmb_; ki<(int)boxes.size(); ++ki)
+      cand.push_back(ki);
+    std::sort(cand.begin(), cand.end());
+  }
+
+  /// All pairs (i, j) with i < j of the sorted boxes that may overlap, in
+  /// lexicographical order
+  void candidatePairs(std::vector<std::pair<int, int> >& pairs) const
+  {
+    pairs.clear();
+    int nmb = (int)idx_.size();
+    int kp;
+#ifdef _OPENMP
+#pragma omp parallel default(none) shared(pairs, nmb) private(kp)
+#endif
+    {
+      std::vector<std::pair<int, int> > local;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 64) nowait
+#endif
+      for (kp=0; kp<nmb; ++kp)
+	{
+	  for (int kq=kp+1; kq<nmb; ++kq)
+	    {
+	      if (high_[kp] < low_[kq] - tol_)
+		break;
+	      if (high_[kq] < low_[kp] - tol_)
+		continue;
+	      local.push_back(std::make_pair(std::min(idx_[kp], idx_[kq]),
+					     std::max(idx_[kp], idx_[kq])));
+	    }
+	}
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+      pairs.insert(pairs.end(), local.begin(), local.end());
+    }
+
+    for (size_t kr=0; kr<other_.size(); ++kr)
+      for (int ki=0; ki<nmb_; ++ki)
+	if (ki != other_[kr] && 
+	    (ki > other_[kr] || 
+	     !std::binary_search(other_.begin(), other_.end(), ki)))
+	  pairs.push_back(std::make_pair(std::min(ki, other_[kr]),
+					 std::max(ki, other_[kr])));
+    std::sort(pairs.begin(), pairs.end());
+  }
+
+private:
+  int dir_;                  // Sweep direction
+  double tol_;
+  double max_ext_;           // Largest box extent in the sweep direction
+  int nmb_;                  // Number of boxes at construction
+  std::vector<int> idx_;     // Box indices sorted on the lower bound
+  std::vector<double> low_;  // Lower bound, sorted
+  std::vector<double> high_; // Upper bound, same order as low_
+  std::vector<int> other_;   // Boxes not sorted, always candidates
+};
     
 // edgeType and faceType encapsulate structures with certain given operations.
 // As of now the structures edgeType and faceType fullfills these requirements.
@@ -173,110 +330,117 @@ public:
 
       orient_inconsist.clear();
 
+      // Candidate face pairs from a sweep over the face boxes. The pairs
+      // come in the same order as in a double loop over the faces
+      std::vector<std::pair<int, int> > face_pairs;
+      BoxSweep sweep(boxes, tol_.neighbour);
+      sweep.candidatePairs(face_pairs);
+
       std::vector<shared_ptr<edgeType> > startedges0, startedges1;
-      for (i = 0; i < num_faces - 1; ++i) {
-	int first = std::max(first_idx, i+1);
-	for (j = first; j < num_faces; ++j) {
-	  // For every combination of faces, do a boxtest.
-	  if (boxes[i].overlaps(boxes[j], tol_.neighbour)) {
-	    // We have some possible neighbourhood incidents.
-	    // Now do a box test on every combination of edges
-	    startedges0 = faces[i]->startEdges();
-	    startedges1 = faces[j]->startEdges();
-	    // Testing all loops in one surface against
-	    // all loops in the other.
-	    for (k = 0; k < int(startedges0.size()); ++k) {
-	      for (l = 0; l < int(startedges1.size()); ++l) {
-		edgeType* s0 = startedges0[k].get();
-		edgeType* s1 = startedges1[l].get();
-		if (s0 ==0 || s1 == 0) break;
-		edgeType* e[2];
-		e[0] = s0;
-		e[1] = s1;
-		edgeType* en[2];
-		bool finished = false;
-		while(!finished) {
-		  en[0] = e[0]->next();
-		  en[1] = e[1]->next();
-		  if (e[0]->twin() && e[0]->twin() == e[1] &&
-		      e[1]->twin() && e[1]->twin() == e[0])
-		    {
-		      // Already tested in the context of edge split
-		      ;
-		    }
-		  else if (e[0]->boundingBox().overlaps(e[1]->boundingBox(),
-						   tol_.neighbour)) {
-#ifdef DEBUG
-		  std::ofstream debug("top_debug.g2");
-		  for (int ki = 0; ki < 2; ++ki) {
-		    e[ki]->face()->surface()->writeStandardHeader(debug);
-		    e[ki]->face()->surface()->write(debug);
-		    std::vector<double> pts(12);
-		    Point from = e[ki]->point(e[ki]->tMin());
-		    double tmid = 0.5*(e[ki]->tMin() + e[ki]->tMax());
-		    Point mid = e[ki]->point(tmid);
-		    Point to = e[ki]->point(e[ki]->tMax());
-		    std::copy(from.begin(), from.end(), pts.begin());
-		    std::copy(mid.begin(), mid.end(), pts.begin() + 3);
-		    std::copy(mid.begin(), mid.end(), pts.begin() + 6);
-		    std::copy(to.begin(), to.end(), pts.begin() + 9);
-		    LineCloud lc(pts.begin(), 2);
-		    lc.writeStandardHeader(debug);
-		    lc.write(debug);
+      for (size_t kp = 0; kp < face_pairs.size(); ++kp) {
+	i = face_pairs[kp].first;
+	j = face_pairs[kp].second;
+	if (j < first_idx)
+	  continue;
+	// For every combination of faces, do a boxtest.
+	if (boxes[i].overlaps(boxes[j], tol_.neighbour)) {
+	  // We have some possible neighbourhood incidents.
+	  // Now do a box test on every combination of edges
+	  startedges0 = faces[i]->startEdges();
+	  startedges1 = faces[j]->startEdges();
+	  // Testing all loops in one surface against
+	  // all loops in the other.
+	  for (k = 0; k < int(startedges0.size()); ++k) {
+	    for (l = 0; l < int(startedges1.size()); ++l) {
+	      edgeType* s0 = startedges0[k].get();
+	      edgeType* s1 = startedges1[l].get();
+	      if (s0 ==0 || s1 == 0) break;
+	      edgeType* e[2];
+	      e[0] = s0;
+	      e[1] = s1;
+	      edgeType* en[2];
+	      bool finished = false;
+	      while(!finished) {
+		en[0] = e[0]->next();
+		en[1] = e[1]->next();
+		if (e[0]->twin() && e[0]->twin() == e[1] &&
+		    e[1]->twin() && e[1]->twin() == e[0])
+		  {
+		    // Already tested in the context of edge split
+		    ;
 		  }
+		else if (e[0]->boundingBox().overlaps(e[1]->boundingBox(),
+						 tol_.neighbour)) {
+#ifdef DEBUG
+		std::ofstream debug("top_debug.g2");
+		for (int ki = 0; ki < 2; ++ki) {
+		  e[ki]->face()->surface()->writeStandardHeader(debug);
+		  e[ki]->face()->surface()->write(debug);
+		  std::vector<double> pts(12);
+		  Point from = e[ki]->point(e[ki]->tMin());
+		  double tmid = 0.5*(e[ki]->tMin() + e[ki]->tMax());
+		  Point mid = e[ki]->point(tmid);
+		  Point to = e[ki]->point(e[ki]->tMax());
+		  std::copy(from.begin(), from.end(), pts.begin());
+		  std::copy(mid.begin(), mid.end(), pts.begin() + 3);
+		  std::copy(mid.begin(), mid.end(), pts.begin() + 6);
+		  std::copy(to.begin(), to.end(), pts.begin() + 9);
+		  LineCloud lc(pts.begin(), 2);
+		  lc.writeStandardHeader(debug);
+		  lc.write(debug);
+		}
 #endif
-		    // We found an edge overlap. Possible incident.
-		    int incident_occurred = 
-		      testEdges(e);
-		    if (incident_occurred) {
-		      // We skip the rest of this subloop (looping
-		      // over edges e[1] in face faces[j]) by
-		      // making en[1] so that e[0] will be
-		      // incremented.
-		      // If e[0] was split w/t-value higher than
-		      // start value, do not forget first part of
-		      // edge.
-
-		      if (incident_occurred >= 2)
-			{
-			  // Inconsistence in face orientation
-			  // Remember incident
-			  // Check if it has occured before
-			  size_t kr;
-			  for (kr=0; kr<orient_inconsist.size(); ++kr)
-			    if ((orient_inconsist[kr].first == faces[i].get() &&
-				 orient_inconsist[kr].second == faces[j].get()) ||
-				(orient_inconsist[kr].first == faces[j].get() &&
-				 orient_inconsist[kr].second == faces[i].get()))
-			      break;
-
-			  if (kr == orient_inconsist.size())
-			    orient_inconsist.push_back(std::make_pair(faces[i].get(),
-								      faces[j].get()));
-			}
-		    }
+		  // We found an edge overlap. Possible incident.
+		  int incident_occurred = 
+		    testEdges(e);
+		  if (incident_occurred) {
+		    // We skip the rest of this subloop (looping
+		    // over edges e[1] in face faces[j]) by
+		    // making en[1] so that e[0] will be
+		    // incremented.
+		    // If e[0] was split w/t-value higher than
+		    // start value, do not forget first part of
+		    // edge.
+
+		    if (incident_occurred >= 2)
+		      {
+			// Inconsistence in face orientation
+			// Remember incident
+			// Check if it has occured before
+			size_t kr;
+			for (kr=0; kr<orient_inconsist.size(); ++kr)
+			  if ((orient_inconsist[kr].first == faces[i].get() &&
+			       orient_inconsist[kr].second == faces[j].get()) ||
+			      (orient_inconsist[kr].first == faces[j].get() &&
+			       orient_inconsist[kr].second == faces[i].get()))
+			    break;
+
+			if (kr == orient_inconsist.size())
+			  orient_inconsist.push_back(std::make_pair(faces[i].get(),
+								    faces[j].get()));
+		      }
 		  }
+		}
 
-		  // 17102017. Adjacency analysis functions with an incremental addition
-		  // of faces have a special security net for sliver faces. This may
-		  // need to be included here. 
+		// 17102017. Adjacency analysis functions with an incremental addition
+		// of faces have a special security net for sliver faces. This may
+		// need to be included here. 
 
-		  // Just to be sure in case the edge loop has changed
-		  startedges0 = faces[i]->startEdges();
-		  startedges1 = faces[j]->startEdges();
-		  edgeType* s0 = startedges0[k].get();
-		  edgeType* s1 = startedges1[l].get();
-		  if (s0 ==0 || s1 == 0) 
-		    break;
-		  // Pick next edges, check if we're done
-		  //e[1] = en[1];
-		  e[1] = e[1]->next();
-		  if (e[1] == s1) {
-		    //e[0] = en[0];
-		    e[0] = e[0]->next();
-		    if (e[0] == s0)
-		      finished = true;
-		  }
+		// Just to be sure in case the edge loop has changed
+		startedges0 = faces[i]->startEdges();
+		startedges1 = faces[j]->startEdges();
+		edgeType* s0 = startedges0[k].get();
+		edgeType* s1 = startedges1[l].get();
+		if (s0 ==0 || s1 == 0) 
+		  break;
+		// Pick next edges, check if we're done
+		//e[1] = en[1];
+		e[1] = e[1]->next();
+		if (e[1] == s1) {
+		  //e[0] = en[0];
+		  e[0] = e[0]->next();
+		  if (e[0] == s0)
+		    finished = true;
 		}
 	      }
 	    }
@@ -616,22 +780,32 @@ public:
       std::ofstream of("top.txt");
 #endif
 
+      // Broad phase. Only the edges where the boxes may overlap in the
+      // sweep direction are visited, in increasing order
+      BoxSweep sweep(boxes, tol_.neighbour);
+      std::vector<int> cand;
+      size_t kc;
+
       edgeType* e[2];
       bool split1 = false, split2 = false;
+      bool removed = false;
       for (ki=nmb0; ki<(int)edges.size(); )
 	{
 	  split1 = false;
-	  for (kj=0; kj<(int)edges.size(); )
+	  sweep.candidates(boxes, ki, cand);
+	  for (kc=0; kc<cand.size(); )
 	    {
+	      kj = cand[kc];
 	      split2 = false;
+	      removed = false;
 	      if (ki == kj)
 		{
-		  kj++;
+		  kc++;
 		  continue;  // Same edge
 		}
 	      if (edges[kj]->face() == edges[ki]->face())
 		{
-		  ++kj;
+		  ++kc;
 		  continue;  
 		}
 
@@ -714,6 +888,7 @@ public:
 			      {
 				edges.erase(edges.begin()+kr);
 				boxes.erase(boxes.begin()+kr);
+				removed = true;
 				if (ki >= (int)kr)
 				  --ki;
 				if (kj >= (int)kr)
@@ -740,6 +915,7 @@ public:
 			      {
 				edges.erase(edges.begin()+kr);
 				boxes.erase(boxes.begin()+kr);
+				removed = true;
 				if (ki >= (int)kr)
 				  --ki;
 				if (kj >= (int)kr)
@@ -764,8 +940,18 @@ public:
 		      split2 = true;
 		    }
 		}
-	      if (!split2)
-		kj++;
+	      if (removed || split2)
+		{
+		  // The edge array is changed. Continue with the current
+		  // edge if it is split, otherwise with the next one
+		  if (removed)
+		    sweep = BoxSweep(boxes, tol_.neighbour);
+		  sweep.candidates(boxes, ki, cand);
+		  kc = std::lower_bound(cand.begin(), cand.end(),
+					(split2) ? kj : kj+1) - cand.begin();
+		}
+	      else
+		kc++;
 	    }
 	  if (!split1)
 	    ki++;
@@ -816,17 +1002,27 @@ public:
       std::ofstream of("top.txt");
 #endif
 
+      // Broad phase. Only the edges where the boxes may overlap in the
+      // sweep direction are visited, in increasing order
+      BoxSweep sweep(boxes, tol_.neighbour);
+      std::vector<int> cand;
+      size_t kc;
+
       edgeType* e[2];
       bool split1 = false, split2 = false;
+      bool removed = false;
       for (ki=nmb0; ki<(int)edges.size(); )
 	{
 	  split1 = false;
-	  for (kj=0; kj<(int)edges.size(); )
+	  sweep.candidates(boxes, ki, cand);
+	  for (kc=0; kc<cand.size(); )
 	    {
+	      kj = cand[kc];
 	      split2 = false;
+	      removed = false;
 	      if (ki == kj)
 		{
-		  kj++;
+		  kc++;
 		  continue;  // Same edge
 		}
 
@@ -908,6 +1104,7 @@ public:
 			      {
 				edges.erase(edges.begin()+kr);
 				boxes.erase(boxes.begin()+kr);
+				removed = true;
 				if (ki >= (int)kr)
 				  --ki;
 				if (nmb1 > (int)kr)
@@ -932,6 +1129,7 @@ public:
 			      {
 				edges.erase(edges.begin()+kr);
 				boxes.erase(boxes.begin()+kr);
+				removed = true;
 				if (kj >= (int)kr)
 				  --kj;
 				if (nmb1 > (int)kr)
@@ -954,8 +1152,18 @@ public:
 		      split2 = true;
 		    }
 		}
-	      if (!split2)
-		kj++;
+	      if (removed || split2)
+		{
+		  // The edge array is changed. Continue with the current
+		  // edge if it is split, otherwise with the next one
+		  if (removed)
+		    sweep = BoxSweep(boxes, tol_.neighbour);
+		  sweep.candidates(boxes, ki, cand);
+		  kc = std::lower_bound(cand.begin(), cand.end(),
+					(split2) ? kj : kj+1) - cand.begin();
+		}
+	      else
+		kc++;
 	    }
 	  if (!split1)
 	    ki++;
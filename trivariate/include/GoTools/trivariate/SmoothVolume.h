@@ -43,6 +43,7 @@
 
 
 #include "GoTools/trivariate/SplineVolume.h"
+#include "GoTools/creators/SparseMatrix.h"
 
 #include <memory>
 #include <vector>
@@ -180,7 +181,7 @@ namespace Go
 
     /// Storage of the equation system.
     int nmb_free_;     // Number of free variables in equation system
-    std::vector<double> gmat_;       // Matrix at left side of equation system
+    SparseMatrix gmat_;              // Matrix at left side of equation system
     std::vector<double> gright_;     // Right side of equation system
     std::vector<int> pivot_;         // Array giving the position of the free coefficients
 
@@ -218,6 +219,11 @@ namespace Go
 
     void resetPivotAndMatrices();
 
+    // Set the sparsity pattern of the matrix at left side of the equation system. Free coefficients
+    // are coupled when their B-splines have overlapping support, or when they are close to a seem
+    // with C1 or C2 continuity.
+    void setMatrixPattern();
+
     // Extend (or build for the first time) the integrals of products of B-spline functions.
     // Only used for the non-rational case. For rational cases, our integrals will be on
     // a function with a denominator, then we can not split into one-dimensional integrals
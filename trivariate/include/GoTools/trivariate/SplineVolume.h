@@ -43,6 +43,7 @@
 
 #include "GoTools/trivariate/ParamVolume.h"
 #include "GoTools/geometry/BsplineBasis.h"
+#include "GoTools/geometry/SplineEvalContext.h"
 #include "GoTools/geometry/SplineSurface.h"
 #include "GoTools/geometry/RectDomain.h"
 #include "GoTools/utils/ScratchVect.h"
@@ -372,6 +373,24 @@ public:
 		       bool w_from_right = true,
 		       double resolution = 1.0e-12) const;
 
+    /// Reentrant version of point(Point&, double, double, double). Knot
+    /// interval hints and temporary storage are kept in the evaluation
+    /// context, the volume itself is not modified. Thus a shared volume may
+    /// be evaluated from several threads, each with its own context.
+    void point(Point& pt, double upar, double vpar, double wpar,
+	       SplineEvalContext& ctx) const;
+
+    /// Reentrant version of point(std::vector<Point>&, double, double, double,
+    /// int, bool, bool, bool, double).
+    void point(std::vector<Point>& pts, 
+	       double upar, double vpar, double wpar,
+	       int derivs,
+	       SplineEvalContext& ctx,
+	       bool u_from_right = true,
+	       bool v_from_right = true,
+	       bool w_from_right = true,
+	       double resolution = 1.0e-12) const;
+
     /// Get the start value for the specified parameter direction.
     /// \param i the parameter direction
     /// \return the start value for the parameter direction given by the parameter pardir
@@ -432,6 +451,30 @@ public:
 			      double         epsilon,
 			      double   *seed = 0) const;
 
+    /// Closest point iteration from a given start parameter, as used by
+    /// closestPoint() once the start parameter is found. Callers doing
+    /// many closest point computations on the same volume may compute
+    /// the periodicity once and call this function directly.
+    /// \param pt the point to find the closest point for
+    /// \param start_par start parameter of the iteration (u, v, w)
+    /// \param closed the periodicity of the volume in each parameter
+    ///               direction, as returned by volumePeriodicity()
+    /// \param clo_u the u-parameter of the closest point
+    /// \param clo_v the v-parameter of the closest point
+    /// \param clo_w the w-parameter of the closest point
+    /// \param clo_pt the closest point
+    /// \param clo_dist the distance to the closest point
+    /// \param epsilon requested accuracy
+    void closestPointIteration(const Point& pt,
+			       const double start_par[],
+			       const int closed[],
+			       double&        clo_u,
+			       double&        clo_v,
+			       double&        clo_w,
+			       Point&         clo_pt,
+			       double&        clo_dist,
+			       double         epsilon) const;
+
     /// Returns the corner closest to a given point together with
     /// the associated enumeration of the corner coefficient.
     /// In degenerate cases, the enumeration will reflect an arbitrary 
@@ -721,7 +764,8 @@ public:
 
     /// Evaluate points and derivatives on an entire grid, taking computational
     /// advantage over calculating all these values simultaneously rather than
-    /// one-by-one.
+    /// one-by-one. The grid evaluators do not modify the volume, and may be
+    /// called concurrently on a shared volume.
     /// \param num_u number of values to evaluate along first parameter direction
     /// \param num_v number of values to evaluate along second parameter direction
     /// \param num_w number of values to evaluate along third parameter directon
@@ -813,6 +857,29 @@ public:
 			const std::vector< double > &param_w,
 			std::vector< double > &points) const;
 
+    /// Evaluate points and derivatives in a batch of scattered parameter
+    /// triples.  This is much faster than calling point() for each triple.
+    /// The triples are grouped by knot span internally, so they may be
+    /// given in any order.  Input and output use a structure of arrays
+    /// layout.  The function does not modify the volume, and may be
+    /// called concurrently on a shared volume.
+    /// \param param_u the first parameter of each triple
+    /// \param param_v the second parameter of each triple
+    /// \param param_w the third parameter of each triple
+    /// \param derivs number of derivatives to compute
+    /// \param result upon function return, coordinate 'c' of derivative
+    ///               'd' in point 'i' is stored in
+    ///               result[(d*dimension() + c)*param_u.size() + i].  The
+    ///               derivatives are ordered as in point(std::vector<Point>&,
+    ///               double, double, double, int, bool, bool, bool, double)
+    ///               and the size is param_u.size()*dimension() times
+    ///               (derivs+1)*(derivs+2)*(derivs+3)/6.
+    void pointsBatch(const std::vector<double>& param_u,
+		     const std::vector<double>& param_v,
+		     const std::vector<double>& param_w,
+		     int derivs,
+		     std::vector<double>& result) const;
+
     /// Evaluate positions and first derivatives of all basis values in a given parameter tripple
     /// For non-rationals this is an interface to BsplineBasis::computeBasisValues 
     /// where the basis values in each parameter direction are multiplied to 
@@ -882,6 +949,22 @@ public:
 		      BasisDerivs& result,
 		      bool evaluate_from_right = true) const;
 
+    /// Reentrant version of computeBasis(double, double, double, BasisPts&)
+    void computeBasis(double param_u,
+		      double param_v,
+		      double param_w,
+		      BasisPts& result,
+		      SplineEvalContext& ctx) const;
+
+    /// Reentrant version of computeBasis(double, double, double, 
+    /// BasisDerivs&, bool)
+    void computeBasis(double param_u,
+		      double param_v,
+		      double param_w,
+		      BasisDerivs& result,
+		      SplineEvalContext& ctx,
+		      bool evaluate_from_right = true) const;
+
     void computeBasis(double param_u,
 		      double param_v,
 		      double param_w,
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 1998, 2000-2007, 2010, 2011, 2012, 2013 SINTEF ICT,
+ * Applied Mathematics, Norway.
+ *
+ * Contact information: E-mail: tor.dokken@sintef.no                      
+ * SINTEF ICT, Department of Applied Mathematics,                         
+ * P.O. Box 124 Blindern,                                                 
+ * 0314 Oslo, Norway.                                                     
+ *
+ * This file is part of GoTools.
+ *
+ * GoTools is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as
+ * published by the Free Software Foundation, either version 3 of the
+ * License, or (at your option) any later version. 
+ *
+ * GoTools is distributed in the hope that it will be useful,        
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of         
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the          
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public
+ * License along with GoTools. If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * In accordance with Section 7(b) of the GNU Affero General Public
+ * License, a covered work must retain the producer line in every data
+ * file that is created or manipulated using GoTools.
+ *
+ * Other Usage
+ * You can be released from the requirements of the license by purchasing
+ * a commercial license. Buying such a license is mandatory as soon as you
+ * develop commercial activities involving the GoTools library without
+ * disclosing the source code of your own applications.
+ *
+ * This file may be used in accordance with the terms contained in a
+ * written agreement between you and SINTEF ICT. 
+ */
+
+#ifndef _VOLUMEINVERSEMAP_H
+#define _VOLUMEINVERSEMAP_H
+
+#include "GoTools/trivariate/SplineVolume.h"
+#include <vector>
+
+namespace Go
+{
+
+/// \brief Inverse mapping from physical space to the parameter domain of a
+/// 3D spline volume, designed for a large number of points, for instance
+/// in particle tracking or transfer of fields between meshes.
+///
+/// The periodicity of the volume and bounding boxes of the Bezier sub
+/// volumes are computed once, when the object is created. The boxes are
+/// those of the control points influencing each knot span cell, and are
+/// organized in an octree over the cell indices. A point is inverted by
+/// Newton iteration on the equation S(u,v,w) = pt, starting at the given
+/// seed or in the middle of the cells whose boxes contain the point. If
+/// this fails, typically since the point lies outside the volume, the
+/// closest point is found by SplineVolume::closestPointIteration().
+/// The volume must not be changed as long as the object is in use.
+class VolumeInverseMap
+{
+public:
+    /// Constructor. The volume must be 3-dimensional.
+    /// \param vol the volume
+    /// \param epsilon geometric tolerance. A point is inside the volume
+    ///                if it is closer to the volume than epsilon.
+    VolumeInverseMap(shared_ptr<SplineVolume> vol, double epsilon);
+
+    /// Destructor.
+    ~VolumeInverseMap();
+
+    /// The volume.
+    shared_ptr<SplineVolume> volume() const
+    { return vol_; }
+
+    /// Number of non-empty knot span cells in the volume.
+    int numCells() const
+    { return ncell_[0]*ncell_[1]*ncell_[2]; }
+
+    /// Find the parameter value of one point. The volume is evaluated
+    /// directly, thus concurrent calls on the same volume are not safe.
+    /// \param pt the point to invert
+    /// \param par upon function return the parameter of the point, or of
+    ///            the closest point in the volume
+    /// \param clo_pt upon function return the point in the volume
+    /// \param clo_dist upon function return the distance between pt and
+    ///                 clo_pt
+    /// \param seed start parameter for the iteration, typically the result
+    ///             for the same point in the previous time step
+    /// \return true if the point lies inside the volume
+    bool inverse(const Point& pt, double par[], Point& clo_pt,
+		 double& clo_dist, const double* seed = 0) const;
+
+    /// Find the parameter values of a set of points. The points are
+    /// distributed over threads when OpenMP is enabled.
+    /// \param pts the points, stored consecutively, size 3*nmb_pts
+    /// \param nmb_pts the number of points
+    /// \param par the parameters of the points (u, v, w), size 3*nmb_pts
+    ///            upon function return. If use_seeds is true, the parameter
+    ///            values given on input are used as start values.
+    /// \param dist upon function return the distance between each point
+    ///             and the volume
+    /// \param use_seeds whether the input values of par are used as
+    ///                  start values
+    /// \return the number of points lying inside the volume
+    int inverse(const double* pts, int nmb_pts, std::vector<double>& par,
+		std::vector<double>& dist, bool use_seeds = false) const;
+
+private:
+    struct Node
+    {
+	double low_[3];
+	double high_[3];
+	int ix0_[3], ix1_[3];  // Cells [ix0_[0], ix1_[0]) x ...
+	int child_;            // First child, -1 for leaves
+	int nmb_child_;
+    };
+
+    shared_ptr<SplineVolume> vol_;
+    double eps_;
+    int closed_[3];            // Periodicity in each parameter direction
+    double minpar_[3], maxpar_[3];
+    int ncell_[3];
+    std::vector<double> cell_par_[3];  // Parameter limits of the cells
+    std::vector<int> cell_knot_[3];    // Knot index of each cell start
+    std::vector<Node> nodes_;
+
+    // Set up node idx for the given range of cells
+    void build(int idx, const int ix0[], const int ix1[]);
+
+    // Bounding box of the control points influencing one cell
+    void cellBox(const int ix[], double low[], double high[]) const;
+
+    // Newton iteration from par. Upon return par is the best parameter
+    // found and derivs[0] the corresponding point. Returns true if the
+    // distance to pt is less than eps_
+    bool newton(const SplineVolume& vol, const Point& pt, double par[],
+		SplineEvalContext& ctx, std::vector<Point>& derivs,
+		double& dist) const;
+
+    // Find the parameter of one point using the given volume for the
+    // evaluation, see inverse()
+    bool invert(const SplineVolume& vol, const Point& pt, double par[],
+		Point& clo_pt, double& clo_dist, const double* seed,
+		SplineEvalContext& ctx, std::vector<Point>& derivs,
+		std::vector<int>& stack,
+		std::vector<std::pair<double, int> >& cand) const;
+};
+
+} // namespace Go
+
+#endif // _VOLUMEINVERSEMAP_H
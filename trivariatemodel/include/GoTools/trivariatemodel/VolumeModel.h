@@ -119,6 +119,16 @@ namespace Go
 		 double clo_par[],   // Parameter value corrsponding to the closest point
 		 double& dist);  // Distance between input point and found closest point
 
+  /// Classify a set of points, given as consecutive (x,y,z) triples, with
+  /// respect to the bodies in the model. See Body::classifyPoints.
+  /// \param pts Points, size 3*nmb_pts.
+  /// \param nmb_pts Number of points.
+  /// \retval body_idx For each point, the index of the body containing it
+  ///                  (inside or on the boundary), -1 if the point is
+  ///                  outside all bodies.
+  void classifyPoints(const double* pts, int nmb_pts,
+		      std::vector<int>& body_idx) const;
+
   /// Intersection with a line, interface heritage, not implemented. 
   /// Expected output is points, probably one point. Curves 
   /// can occur in special configurations. 